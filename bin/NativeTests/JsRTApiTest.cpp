@@ -1810,6 +1810,312 @@ namespace JsRTApiTest
         JsRTApiTest::RunWithAttributes(JsRTApiTest::UnsetPromiseContinuation);
     }
 
+    void MicrotaskQueueTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        unsigned int jobsRun = 0;
+        bool hasPendingJobs = false;
+        int count = 0;
+
+        // draining before the queue is enabled is an error
+        REQUIRE(JsDrainMicrotasks(0, &jobsRun, &hasPendingJobs) == JsErrorInvalidArgument);
+
+        REQUIRE(JsEnableMicrotaskQueue() == JsNoError);
+        REQUIRE(JsRunScript(
+            _u("var count = 0;") \
+            _u("Promise.resolve().then(() => count++).then(() => count++);") \
+            _u("Promise.resolve().then(() => count++);"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        // the budget is honored
+        REQUIRE(JsDrainMicrotasks(1, &jobsRun, &hasPendingJobs) == JsNoError);
+        CHECK(jobsRun == 1);
+        CHECK(hasPendingJobs);
+
+        // jobs queued while draining run in the same call
+        REQUIRE(JsDrainMicrotasks(0, &jobsRun, &hasPendingJobs) == JsNoError);
+        CHECK(jobsRun == 2);
+        CHECK(!hasPendingJobs);
+
+        REQUIRE(JsRunScript(_u("count"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &count) == JsNoError);
+        CHECK(count == 3);
+
+        REQUIRE(JsDrainMicrotasks(0, &jobsRun, &hasPendingJobs) == JsNoError);
+        CHECK(jobsRun == 0);
+        CHECK(!hasPendingJobs);
+    }
+
+    TEST_CASE("ApiTest_MicrotaskQueue", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::MicrotaskQueueTest);
+    }
+
+    void SamplingHeapProfilerTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsValueRef profile = JS_INVALID_REFERENCE;
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef profileId = JS_INVALID_REFERENCE;
+        bool found = false;
+
+        // there is no profile before the profiler is started
+        REQUIRE(JsGetSamplingHeapProfile(&profile) == JsErrorInvalidArgument);
+        REQUIRE(JsStartSamplingHeapProfiler(runtime, 0) == JsErrorInvalidArgument);
+
+        // sample every allocation
+        REQUIRE(JsStartSamplingHeapProfiler(runtime, 1) == JsNoError);
+        REQUIRE(JsRunScript(
+            _u("function allocateHere() { var a = []; for (var i = 0; i < 10; i++) { a.push({ i: i }); } return a; }") \
+            _u("var kept = allocateHere();"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsGetSamplingHeapProfile(&profile) == JsNoError);
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("profile"), &profileId) == JsNoError);
+        REQUIRE(JsSetProperty(global, profileId, profile, true) == JsNoError);
+
+        REQUIRE(JsRunScript(
+            _u("profile.samplingInterval === 1 && profile.allocations.some(function (a) {") \
+            _u("    return a.size > 0 && a.count > 0 && a.stack.length === 2 &&") \
+            _u("        a.stack[0].functionName === 'allocateHere' && a.stack[0].line === 0; })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &found) == JsNoError);
+        CHECK(found);
+
+        REQUIRE(JsStopSamplingHeapProfiler(runtime) == JsNoError);
+        REQUIRE(JsGetSamplingHeapProfile(&profile) == JsErrorInvalidArgument);
+    }
+
+    TEST_CASE("ApiTest_SamplingHeapProfiler", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SamplingHeapProfilerTest);
+    }
+
+    void SamplingHeapProfilerJitTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsValueRef profile = JS_INVALID_REFERENCE;
+        JsValueRef global = JS_INVALID_REFERENCE;
+        JsPropertyIdRef profileId = JS_INVALID_REFERENCE;
+        bool found = false;
+
+        // Sample every allocation while functions are jitted, make helper calls that allocate from jitted code, and bail
+        // out into the interpreter, allocating on the way. Every one of those allocations walks the stack.
+        REQUIRE(JsStartSamplingHeapProfiler(runtime, 1) == JsNoError);
+        REQUIRE(JsRunScript(
+            _u("function hot(a, b) { var r = []; for (var i = 0; i < 4; i++) { r.push({ v: a + b }); } return r; }") \
+            _u("function concat(a, b) { return 'x' + a + b; }") \
+            _u("function bail(x, y) { var s = x + y; if (typeof s === 'string') { return arguments.length + [s].length; } return s; }") \
+            _u("function closure(n) { return function () { return n; }; }") \
+            _u("var kept = [];") \
+            _u("for (var i = 0; i < 20000; i++) { kept = hot(i, 1); concat(i, i); bail(i, 1); closure(i)(); }") \
+            _u("for (var i = 0; i < 100; i++) { kept = kept.concat(hot('a', i)); bail('a', i); }") \
+            _u("kept.length"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsGetSamplingHeapProfile(&profile) == JsNoError);
+        REQUIRE(JsGetGlobalObject(&global) == JsNoError);
+        REQUIRE(JsGetPropertyIdFromName(_u("profile"), &profileId) == JsNoError);
+        REQUIRE(JsSetProperty(global, profileId, profile, true) == JsNoError);
+
+        REQUIRE(JsRunScript(
+            _u("profile.allocations.every(function (a) {") \
+            _u("    return a.size > 0 && a.count > 0 && a.stack.every(function (f) {") \
+            _u("        return typeof f.functionName === 'string' && typeof f.url === 'string' && f.line >= 0 && f.column >= 0; }); }) &&") \
+            _u("profile.allocations.some(function (a) { return a.stack.length > 0 && a.stack[0].functionName === 'hot'; })"),
+            JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsBooleanToBool(result, &found) == JsNoError);
+        CHECK(found);
+
+        REQUIRE(JsStopSamplingHeapProfiler(runtime) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_SamplingHeapProfilerJit", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::SamplingHeapProfilerJitTest);
+    }
+
+    struct HeapSnapshotState
+    {
+        int chunkCount;
+        bool malformed;
+        unsigned __int64 leakObject;
+        unsigned int payloadName;
+        bool foundLeakFunction;
+        bool foundPayloadEdge;
+    };
+
+    template <typename T>
+    T ReadHeapSnapshotField(const BYTE * chunk, size_t &offset)
+    {
+        T value;
+        memcpy(&value, chunk + offset, sizeof(T));
+        offset += sizeof(T);
+        return value;
+    }
+
+    bool IsHeapSnapshotName(const BYTE * chunk, size_t offset, unsigned int length, const WCHAR * name)
+    {
+        return length == wcslen(name) && memcmp(chunk + offset, name, length * sizeof(WCHAR)) == 0;
+    }
+
+    bool CALLBACK HeapSnapshotChunkCallback(const BYTE * chunk, size_t length, void * callbackState)
+    {
+        HeapSnapshotState * state = (HeapSnapshotState *)callbackState;
+        state->chunkCount++;
+
+        size_t offset = 0;
+        while (offset < length)
+        {
+            switch (chunk[offset++])
+            {
+            case JsHeapSnapshotRecordNode:
+            {
+                unsigned __int64 id = ReadHeapSnapshotField<unsigned __int64>(chunk, offset);
+                ReadHeapSnapshotField<unsigned __int64>(chunk, offset);
+                int type = ReadHeapSnapshotField<int>(chunk, offset);
+                unsigned int nameLength = ReadHeapSnapshotField<unsigned int>(chunk, offset);
+                if (IsHeapSnapshotName(chunk, offset, nameLength, _u("Leak")))
+                {
+                    if (type == JsFunction)
+                    {
+                        state->foundLeakFunction = true;
+                    }
+                    else if (type == JsObject)
+                    {
+                        state->leakObject = id;
+                    }
+                }
+                offset += nameLength * sizeof(WCHAR);
+                break;
+            }
+            case JsHeapSnapshotRecordEdge:
+            {
+                unsigned __int64 from = ReadHeapSnapshotField<unsigned __int64>(chunk, offset);
+                ReadHeapSnapshotField<unsigned __int64>(chunk, offset);
+                unsigned int name = ReadHeapSnapshotField<unsigned int>(chunk, offset);
+                if (from == state->leakObject && name == state->payloadName)
+                {
+                    state->foundPayloadEdge = true;
+                }
+                break;
+            }
+            case JsHeapSnapshotRecordPropertyName:
+            {
+                unsigned int id = ReadHeapSnapshotField<unsigned int>(chunk, offset);
+                unsigned int nameLength = ReadHeapSnapshotField<unsigned int>(chunk, offset);
+                if (IsHeapSnapshotName(chunk, offset, nameLength, _u("payload")))
+                {
+                    state->payloadName = id;
+                }
+                offset += nameLength * sizeof(WCHAR);
+                break;
+            }
+            default:
+                state->malformed = true;
+                return false;
+            }
+        }
+
+        // records are never split across chunks
+        state->malformed = state->malformed || offset != length;
+        return true;
+    }
+
+    bool CALLBACK StopHeapSnapshotChunkCallback(const BYTE * chunk, size_t length, void * callbackState)
+    {
+        ((HeapSnapshotState *)callbackState)->chunkCount++;
+        return false;
+    }
+
+    void HeapSnapshotTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+
+        REQUIRE(JsRunScript(
+            _u("function Leak() { this.payload = { size: 1 }; }") \
+            _u("Leak.prototype.describe = function () { return 'leak'; };") \
+            _u("var leaks = [new Leak(), new Leak()];"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsStreamHeapSnapshot(runtime, nullptr, nullptr) == JsErrorNullArgument);
+
+        HeapSnapshotState state = { 0, false, 0, (unsigned int)-1, false, false };
+        REQUIRE(JsStreamHeapSnapshot(runtime, HeapSnapshotChunkCallback, &state) == JsNoError);
+        CHECK(state.chunkCount > 0);
+        CHECK(!state.malformed);
+        CHECK(state.foundLeakFunction);
+        CHECK(state.leakObject != 0);
+        CHECK(state.foundPayloadEdge);
+
+        // the host can stop the snapshot
+        HeapSnapshotState stopState = { 0, false, 0, (unsigned int)-1, false, false };
+        REQUIRE(JsStreamHeapSnapshot(runtime, StopHeapSnapshotChunkCallback, &stopState) == JsNoError);
+        CHECK(stopState.chunkCount == 1);
+
+        // the runtime can still run script afterwards
+        REQUIRE(JsRunScript(_u("leaks.length"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_HeapSnapshot", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::HeapSnapshotTest);
+    }
+
+    void JitQueueStatsTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        JsJitQueueStats stats;
+
+        REQUIRE(JsGetRuntimeJitQueueStats(runtime, nullptr) == JsErrorNullArgument);
+
+        REQUIRE(JsRunScript(
+            _u("function hot(a) { var s = 0; for (var i = 0; i < a.length; i++) { s += a[i]; } return s; }") \
+            _u("var arr = [1, 2, 3, 4]; for (var j = 0; j < 10000; j++) { hot(arr); }"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+
+        REQUIRE(JsGetRuntimeJitQueueStats(runtime, &stats) == JsNoError);
+        if (attributes & JsRuntimeAttributeDisableNativeCodeGeneration)
+        {
+            CHECK(stats.simpleJit.queuedCount == 0);
+            CHECK(stats.fullJit.queuedCount == 0);
+        }
+
+        // background compiles may still be running, so only the invariants between the counters hold
+        CHECK(stats.simpleJit.compiledCount <= stats.simpleJit.queuedCount);
+        CHECK(stats.fullJit.compiledCount <= stats.fullJit.queuedCount);
+        CHECK(stats.droppedCount <= stats.fullJit.queuedCount);
+        CHECK(stats.maxFullJitQueueDepth <= stats.fullJit.queuedCount);
+    }
+
+    TEST_CASE("ApiTest_JitQueueStats", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::JitQueueStatsTest);
+    }
+
+    void NumaNodeTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
+    {
+        JsValueRef result = JS_INVALID_REFERENCE;
+        int length = 0;
+
+        REQUIRE(JsSetRuntimeNumaNode(runtime, -2) == JsErrorInvalidArgument);
+        REQUIRE(JsSetRuntimeNumaNode(runtime, 4096) == JsErrorInvalidArgument);
+
+        // every machine has a node 0; allocate and collect enough for new segments and the helper threads to follow it
+        REQUIRE(JsSetRuntimeNumaNode(runtime, 0) == JsNoError);
+        REQUIRE(JsRunScript(
+            _u("var kept = []; for (var i = 0; i < 100000; i++) { kept.push({ i: i, s: 'x' + i }); }") \
+            _u("kept.length"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+        REQUIRE(JsNumberToInt(result, &length) == JsNoError);
+        CHECK(length == 100000);
+
+        REQUIRE(JsSetRuntimeNumaNode(runtime, -1) == JsNoError);
+        REQUIRE(JsRunScript(_u("kept = null; 1"), JS_SOURCE_CONTEXT_NONE, _u(""), &result) == JsNoError);
+        REQUIRE(JsCollectGarbage(runtime) == JsNoError);
+    }
+
+    TEST_CASE("ApiTest_NumaNode", "[ApiTest]")
+    {
+        JsRTApiTest::RunWithAttributes(JsRTApiTest::NumaNodeTest);
+    }
+
     void ArrayBufferTest(JsRuntimeAttributes attributes, JsRuntimeHandle runtime)
     {
         for (int type = JsArrayTypeInt8; type <= JsArrayTypeFloat64; type++)
@@ -6,241 +6,47 @@
 
 #if !FLOATVAR
 CodeGenNumberThreadAllocator::CodeGenNumberThreadAllocator(Recycler * recycler)
-    : recycler(recycler), currentNumberSegment(nullptr), currentChunkSegment(nullptr),
-    numberSegmentEnd(nullptr), currentNumberBlockEnd(nullptr), nextNumber(nullptr), chunkSegmentEnd(nullptr),
-    currentChunkBlockEnd(nullptr), nextChunk(nullptr), hasNewNumberBlock(nullptr), hasNewChunkBlock(nullptr),
-    pendingIntegrationNumberSegmentCount(0), pendingIntegrationChunkSegmentCount(0),
-    pendingIntegrationNumberSegmentPageCount(0), pendingIntegrationChunkSegmentPageCount(0)
+    : numberBuffer(recycler), chunkBuffer(recycler)
 {
 }
 
-CodeGenNumberThreadAllocator::~CodeGenNumberThreadAllocator()
-{
-    pendingIntegrationNumberSegment.Clear(&NoThrowNoMemProtectHeapAllocator::Instance);
-    pendingIntegrationChunkSegment.Clear(&NoThrowNoMemProtectHeapAllocator::Instance);
-    pendingIntegrationNumberBlock.Clear(&NoThrowHeapAllocator::Instance);
-    pendingIntegrationChunkBlock.Clear(&NoThrowHeapAllocator::Instance);
-    pendingFlushNumberBlock.Clear(&NoThrowHeapAllocator::Instance);
-    pendingFlushChunkBlock.Clear(&NoThrowHeapAllocator::Instance);
-    pendingReferenceNumberBlock.Clear(&NoThrowHeapAllocator::Instance);
-}
-
-size_t
-CodeGenNumberThreadAllocator::GetNumberAllocSize()
-{
-#ifdef RECYCLER_MEMORY_VERIFY
-    if (recycler->VerifyEnabled())
-    {
-        return HeapInfo::GetAlignedSize(AllocSizeMath::Add(sizeof(Js::JavascriptNumber) + sizeof(size_t), recycler->verifyPad));
-    }
-#endif
-    return HeapInfo::GetAlignedSizeNoCheck(sizeof(Js::JavascriptNumber));
-}
-
-
-size_t
-CodeGenNumberThreadAllocator::GetChunkAllocSize()
-{
-#ifdef RECYCLER_MEMORY_VERIFY
-    if (recycler->VerifyEnabled())
-    {
-        return HeapInfo::GetAlignedSize(AllocSizeMath::Add(sizeof(CodeGenNumberChunk) + sizeof(size_t), recycler->verifyPad));
-    }
-#endif
-    return HeapInfo::GetAlignedSizeNoCheck(sizeof(CodeGenNumberChunk));
-}
-
 Js::JavascriptNumber *
 CodeGenNumberThreadAllocator::AllocNumber()
 {
     AutoCriticalSection autocs(&cs);
-    size_t sizeCat = GetNumberAllocSize();
-    if (nextNumber + sizeCat > currentNumberBlockEnd)
-    {
-        AllocNewNumberBlock();
-    }
-    Js::JavascriptNumber * newNumber = (Js::JavascriptNumber *)nextNumber;
-#ifdef RECYCLER_MEMORY_VERIFY
-    recycler->FillCheckPad(newNumber, sizeof(Js::JavascriptNumber), sizeCat);
-#endif
-
-    nextNumber += sizeCat;
-    return newNumber;
+    return numberBuffer.Alloc();
 }
 
 CodeGenNumberChunk *
 CodeGenNumberThreadAllocator::AllocChunk()
 {
     AutoCriticalSection autocs(&cs);
-    size_t sizeCat = GetChunkAllocSize();
-    if (nextChunk + sizeCat > currentChunkBlockEnd)
+    CodeGenNumberChunk * newChunk = chunkBuffer.Alloc();
+    if (chunkBuffer.HasFilledBlocks())
     {
-        AllocNewChunkBlock();
+        // The full chunk block holds the references to the numbers in the full number blocks
+        chunkBuffer.Seal();
+        numberBuffer.Seal();
     }
-    CodeGenNumberChunk * newChunk = (CodeGenNumberChunk *)nextChunk;
-#ifdef RECYCLER_MEMORY_VERIFY
-    recycler->FillCheckPad(nextChunk, sizeof(CodeGenNumberChunk), sizeCat);
-#endif
 
     memset(newChunk, 0, sizeof(CodeGenNumberChunk));
-    nextChunk += sizeCat;
     return newChunk;
 }
 
-void
-CodeGenNumberThreadAllocator::AllocNewNumberBlock()
-{
-    Assert(cs.IsLocked());
-    Assert(nextNumber + GetNumberAllocSize() > currentNumberBlockEnd);
-    if (hasNewNumberBlock)
-    {
-        if (!pendingReferenceNumberBlock.PrependNode(&NoThrowHeapAllocator::Instance,
-            currentNumberBlockEnd - BlockSize, currentNumberSegment))
-        {
-            Js::Throw::OutOfMemory();
-        }
-        hasNewNumberBlock = false;
-    }
-
-    if (currentNumberBlockEnd == numberSegmentEnd)
-    {
-        Assert(cs.IsLocked());
-        // Reserve the segment, but not committing it
-        currentNumberSegment = PageAllocator::AllocPageSegment(pendingIntegrationNumberSegment, this->recycler->GetDefaultHeapInfo()->GetRecyclerLeafPageAllocator(), false, true, false);
-        if (currentNumberSegment == nullptr)
-        {
-            currentNumberBlockEnd = nullptr;
-            numberSegmentEnd = nullptr;
-            nextNumber = nullptr;
-            Js::Throw::OutOfMemory();
-        }
-        pendingIntegrationNumberSegmentCount++;
-        pendingIntegrationNumberSegmentPageCount += currentNumberSegment->GetPageCount();
-        currentNumberBlockEnd = currentNumberSegment->GetAddress();
-        numberSegmentEnd = currentNumberSegment->GetEndAddress();
-    }
-
-    // Commit the page.
-    if (!::VirtualAlloc(currentNumberBlockEnd, BlockSize, MEM_COMMIT, PAGE_READWRITE))
-    {
-        Js::Throw::OutOfMemory();
-    }
-    nextNumber = currentNumberBlockEnd;
-    currentNumberBlockEnd += BlockSize;
-    hasNewNumberBlock = true;
-    this->recycler->GetDefaultHeapInfo()->GetRecyclerLeafPageAllocator()->FillAllocPages(nextNumber, 1);
-}
-
-void
-CodeGenNumberThreadAllocator::AllocNewChunkBlock()
-{
-    Assert(cs.IsLocked());
-    Assert(nextChunk + GetChunkAllocSize() > currentChunkBlockEnd);
-    if (hasNewChunkBlock)
-    {
-        if (!pendingFlushChunkBlock.PrependNode(&NoThrowHeapAllocator::Instance,
-            currentChunkBlockEnd - BlockSize, currentChunkSegment))
-        {
-            Js::Throw::OutOfMemory();
-        }
-        // All integrated pages' object are all live initially, so don't need to rescan them
-        // todo: SWB: need to allocate number with write barrier pages
-        ::ResetWriteWatch(currentChunkBlockEnd - BlockSize, BlockSize);
-        pendingReferenceNumberBlock.MoveTo(&pendingFlushNumberBlock);
-        hasNewChunkBlock = false;
-    }
-
-    if (currentChunkBlockEnd == chunkSegmentEnd)
-    {
-        Assert(cs.IsLocked());
-        // Reserve the segment, but not committing it
-        currentChunkSegment = PageAllocator::AllocPageSegment(pendingIntegrationChunkSegment, this->recycler->GetDefaultHeapInfo()->GetRecyclerPageAllocator(), false, true, false);
-        if (currentChunkSegment == nullptr)
-        {
-            currentChunkBlockEnd = nullptr;
-            chunkSegmentEnd = nullptr;
-            nextChunk = nullptr;
-            Js::Throw::OutOfMemory();
-        }
-        pendingIntegrationChunkSegmentCount++;
-        pendingIntegrationChunkSegmentPageCount += currentChunkSegment->GetPageCount();
-        currentChunkBlockEnd = currentChunkSegment->GetAddress();
-        chunkSegmentEnd = currentChunkSegment->GetEndAddress();
-    }
-
-    // Commit the page.
-    if (!::VirtualAlloc(currentChunkBlockEnd, BlockSize, MEM_COMMIT, PAGE_READWRITE))
-    {
-        Js::Throw::OutOfMemory();
-    }
-
-    nextChunk = currentChunkBlockEnd;
-    currentChunkBlockEnd += BlockSize;
-    hasNewChunkBlock = true;
-    this->recycler->GetDefaultHeapInfo()->GetRecyclerLeafPageAllocator()->FillAllocPages(nextChunk, 1);
-}
-
 void
 CodeGenNumberThreadAllocator::Integrate()
 {
     AutoCriticalSection autocs(&cs);
-    PageAllocator * leafPageAllocator = this->recycler->GetDefaultHeapInfo()->GetRecyclerLeafPageAllocator();
-    leafPageAllocator->IntegrateSegments(pendingIntegrationNumberSegment, pendingIntegrationNumberSegmentCount, pendingIntegrationNumberSegmentPageCount);
-    PageAllocator * recyclerPageAllocator = this->recycler->GetDefaultHeapInfo()->GetRecyclerPageAllocator();
-    recyclerPageAllocator->IntegrateSegments(pendingIntegrationChunkSegment, pendingIntegrationChunkSegmentCount, pendingIntegrationChunkSegmentPageCount);
-    pendingIntegrationNumberSegmentCount = 0;
-    pendingIntegrationChunkSegmentCount = 0;
-    pendingIntegrationNumberSegmentPageCount = 0;
-    pendingIntegrationChunkSegmentPageCount = 0;
-
-#ifdef TRACK_ALLOC
-    TrackAllocData oldAllocData = recycler->nextAllocData;
-    recycler->nextAllocData.Clear();
-#endif
-    while (!pendingIntegrationNumberBlock.Empty())
-    {
-        TRACK_ALLOC_INFO(recycler, Js::JavascriptNumber, Recycler, 0, (size_t)-1);
-
-        BlockRecord& record = pendingIntegrationNumberBlock.Head();
-        if (!recycler->IntegrateBlock<LeafBit>(record.blockAddress, record.segment, GetNumberAllocSize(), sizeof(Js::JavascriptNumber)))
-        {
-            Js::Throw::OutOfMemory();
-        }
-        pendingIntegrationNumberBlock.RemoveHead(&NoThrowHeapAllocator::Instance);
-    }
-
-
-    while (!pendingIntegrationChunkBlock.Empty())
-    {
-        // REVIEW: the above number block integration can be moved into this loop
-
-        TRACK_ALLOC_INFO(recycler, CodeGenNumberChunk, Recycler, 0, (size_t)-1);
-
-        BlockRecord& record = pendingIntegrationChunkBlock.Head();
-        if (!recycler->IntegrateBlock<NoBit>(record.blockAddress, record.segment, GetChunkAllocSize(), sizeof(CodeGenNumberChunk)))
-        {
-            Js::Throw::OutOfMemory();
-        }
-#if DBG && GLOBAL_ENABLE_WRITE_BARRIER
-        if (CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(RecyclerVerifyMark))
-        {
-            Recycler::WBSetBitRange(record.blockAddress, BlockSize / sizeof(void*));
-        }
-#endif
-        pendingIntegrationChunkBlock.RemoveHead(&NoThrowHeapAllocator::Instance);
-    }
-#ifdef TRACK_ALLOC
-    Assert(recycler->nextAllocData.IsEmpty());
-    recycler->nextAllocData = oldAllocData;
-#endif
+    numberBuffer.Integrate();
+    chunkBuffer.Integrate();
 }
 
 void
 CodeGenNumberThreadAllocator::FlushAllocations()
 {
     AutoCriticalSection autocs(&cs);
-    pendingFlushNumberBlock.MoveTo(&pendingIntegrationNumberBlock);
-    pendingFlushChunkBlock.MoveTo(&pendingIntegrationChunkBlock);
+    numberBuffer.Flush();
+    chunkBuffer.Flush();
 }
 
 CodeGenNumberAllocator::CodeGenNumberAllocator(CodeGenNumberThreadAllocator * threadAlloc, Recycler * recycler) :
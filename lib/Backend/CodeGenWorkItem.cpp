@@ -18,6 +18,7 @@ CodeGenWorkItem::CodeGenWorkItem(
     , recyclableData(nullptr)
     , isInJitQueue(false)
     , isAllocationCommitted(false)
+    , inlinedByteCodeCount(0)
     , queuedFullJitWorkItem(nullptr)
     , allocation(nullptr)
 #ifdef IR_VIEWER
@@ -31,6 +32,7 @@ CodeGenWorkItem::CodeGenWorkItem(
     this->jitData.type = type;
     this->jitData.isJitInDebugMode = isJitInDebugMode;
     ResetJitMode();
+    this->queuedTime.QuadPart = 0;
 }
 
 CodeGenWorkItem::~CodeGenWorkItem()
@@ -126,6 +128,11 @@ void CodeGenWorkItem::OnAddToJitQueue()
     VerifyJitMode();
 
     this->entryPointInfo->SetCodeGenQueued();
+    this->queuedTime.QuadPart = 0;
+    if(this->functionBody->GetScriptContext()->GetThreadContext()->GetJitQueueStats()->IsTimingEnabled())
+    {
+        QueryPerformanceCounter(&this->queuedTime);
+    }
     if(IS_JS_ETW(EventEnabledJSCRIPT_FUNCTION_JIT_QUEUED()))
     {
         WCHAR displayNameBuffer[256];
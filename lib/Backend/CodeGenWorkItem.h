@@ -70,6 +70,10 @@ struct CodeGenWorkItem : public JsUtil::Job
         return functionBody;
     }
 
+    // Bytecode the backend will see for this work item: its own plus that of the inlinees picked while gathering code gen data
+    uint GetCompileByteCodeCount() const { return GetByteCodeCount() + inlinedByteCodeCount; }
+    void SetInlinedByteCodeCount(uint count) { this->inlinedByteCodeCount = count; }
+
     void SetCodeSize(ptrdiff_t codeSize) { this->codeSize = codeSize; }
     ptrdiff_t GetCodeSize() { return codeSize; }
 
@@ -89,10 +93,13 @@ struct CodeGenWorkItem : public JsUtil::Job
 private:
     bool isInJitQueue;                  // indicates if the work item has been added to the global jit queue
     bool isAllocationCommitted;         // Whether the EmitBuffer allocation has been committed
+    uint inlinedByteCodeCount;          // Bytecode inlined into this work item, set when code gen data is gathered
 
     QueuedFullJitWorkItem *queuedFullJitWorkItem;
     EmitBufferAllocation<VirtualAllocWrapper, PreReservedVirtualAllocWrapper> *allocation;
 
+    LARGE_INTEGER queuedTime;           // when the work item was last added to the jit queue, for the jit queue stats (zero when not timed)
+
 #ifdef IR_VIEWER
 public:
     bool isRejitIRViewerFunction;               // re-JIT function for IRViewer object generation
@@ -124,6 +131,11 @@ struct CodeGenWorkItem : public JsUtil::Job
         return this->entryPointInfo;
     }
 
+    LARGE_INTEGER GetQueuedTime() const
+    {
+        return this->queuedTime;
+    }
+
     Js::CodeGenRecyclableData *RecyclableData() const
     {
         return recyclableData;
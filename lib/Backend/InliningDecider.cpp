@@ -6,7 +6,7 @@
 #include "Backend.h"
 
 InliningDecider::InliningDecider(Js::FunctionBody *const topFunc, bool isLoopBody, bool isInDebugMode, const ExecutionMode jitMode)
-    : topFunc(topFunc), isLoopBody(isLoopBody), isInDebugMode(isInDebugMode), jitMode(jitMode), bytecodeInlinedCount(0), numberOfInlineesWithLoop(0), threshold(topFunc->GetByteCodeWithoutLDACount(), isLoopBody, topFunc->GetIsAsmjsMode())
+    : topFunc(topFunc), isLoopBody(isLoopBody), isInDebugMode(isInDebugMode), jitMode(jitMode), bytecodeInlinedCount(0), numberOfInlineesWithLoop(0), callSiteHeatInliner(nullptr), callSiteHeatMaxFrequency(0), threshold(topFunc->GetByteCodeWithoutLDACount(), isLoopBody, topFunc->GetIsAsmjsMode())
 {
     Assert(topFunc);
 }
@@ -144,11 +144,61 @@ Js::FunctionInfo *InliningDecider::InlineCallSite(Js::FunctionBody *const inline
     Js::FunctionInfo *functionInfo = GetCallSiteFuncInfo(inliner, profiledCallSiteId, &isConstructorCall, &isPolymorphicCall);
     if (functionInfo)
     {
-        return Inline(inliner, functionInfo, isConstructorCall, false, false, GetConstantArgInfo(inliner, profiledCallSiteId), profiledCallSiteId, recursiveInlineDepth, true);
+        return Inline(inliner, functionInfo, isConstructorCall, false, false, GetConstantArgInfo(inliner, profiledCallSiteId), profiledCallSiteId, recursiveInlineDepth, true,
+            GetCallSiteHeat(inliner, profiledCallSiteId));
     }
     return nullptr;
 }
 
+InliningDecider::CallSiteHeat InliningDecider::GetCallSiteHeat(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId)
+{
+    Assert(inliner);
+    Assert(profiledCallSiteId < inliner->GetProfiledCallSiteCount());
+
+    if (PHASE_OFF(Js::InlineHotCallSitesPhase, this->topFunc) || PHASE_OFF(Js::InlineHotCallSitesPhase, inliner))
+    {
+        return CallSiteHeat::Unknown;
+    }
+
+    const auto profileData = inliner->GetAnyDynamicProfileInfo();
+    Assert(profileData);
+    if (!profileData->HasCallSiteFrequencies())
+    {
+        return CallSiteHeat::Unknown;
+    }
+
+    // Call sites are weighed against the hottest call site of the same inliner, so the weight does not depend on
+    // whether the calls were profiled by the interpreter or by simple JIT code.
+    if (this->callSiteHeatInliner != inliner)
+    {
+        uint32 maxFrequency = 0;
+        for (Js::ProfileId i = 0; i < inliner->GetProfiledCallSiteCount(); ++i)
+        {
+            maxFrequency = max(maxFrequency, profileData->GetCallSiteFrequency(i));
+        }
+        this->callSiteHeatInliner = inliner;
+        this->callSiteHeatMaxFrequency = maxFrequency;
+    }
+
+    if (this->callSiteHeatMaxFrequency < (uint32)CONFIG_FLAG(HotCallSiteInlineMinCount))
+    {
+        // Not enough samples to tell hot and cold call sites apart
+        return CallSiteHeat::Unknown;
+    }
+
+    const uint32 frequency = profileData->GetCallSiteFrequency(profiledCallSiteId);
+    const uint64 percent = (uint64)frequency * 100 / this->callSiteHeatMaxFrequency;
+    if (frequency >= (uint32)CONFIG_FLAG(HotCallSiteInlineMinCount) && percent >= (uint64)CONFIG_FLAG(HotCallSiteInlinePercent))
+    {
+        return CallSiteHeat::Hot;
+    }
+    if (percent < (uint64)CONFIG_FLAG(ColdCallSiteInlinePercent))
+    {
+        return CallSiteHeat::Cold;
+    }
+    return CallSiteHeat::Warm;
+}
+
 Js::FunctionInfo * InliningDecider::InlineCallback(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId, uint recursiveInlineDepth)
 {
     Js::FunctionInfo * functionInfo = GetCallSiteCallbackInfo(inliner, profiledCallSiteId);
@@ -185,6 +235,8 @@ uint InliningDecider::InlinePolymorphicCallSite(Js::FunctionBody *const inliner,
         return 0;
     }
 
+    const CallSiteHeat callSiteHeat = GetCallSiteHeat(inliner, profiledCallSiteId);
+
     uint inlineeCount = 0;
     uint actualInlineeCount  = 0;
 
@@ -195,7 +247,7 @@ uint InliningDecider::InlinePolymorphicCallSite(Js::FunctionBody *const inliner,
             AssertMsg(inlineeCount >= 2, "There are at least two polymorphic call site");
             break;
         }
-        if (Inline(inliner, functionBodyArray[inlineeCount]->GetFunctionInfo(), isConstructorCall, true /*isPolymorphicCall*/, false /*isCallback*/, 0, profiledCallSiteId, recursiveInlineDepth, false))
+        if (Inline(inliner, functionBodyArray[inlineeCount]->GetFunctionInfo(), isConstructorCall, true /*isPolymorphicCall*/, false /*isCallback*/, 0, profiledCallSiteId, recursiveInlineDepth, false, callSiteHeat))
         {
             canInlineArray[inlineeCount] = true;
             actualInlineeCount++;
@@ -232,7 +284,8 @@ Js::FunctionInfo *InliningDecider::Inline(Js::FunctionBody *const inliner,
     uint16 constantArgInfo, 
     Js::ProfileId callSiteId, 
     uint recursiveInlineDepth, 
-    bool allowRecursiveInlining)
+    bool allowRecursiveInlining,
+    CallSiteHeat callSiteHeat)
 {
 #if defined(DBG_DUMP) || defined(ENABLE_DEBUG_CONFIG_OPTIONS)
     char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
@@ -316,7 +369,7 @@ Js::FunctionInfo *InliningDecider::Inline(Js::FunctionBody *const inliner,
             return nullptr;
         }
 
-        if (!DeciderInlineIntoInliner(inlinee, inliner, isConstructorCall, isPolymorphicCall, constantArgInfo, recursiveInlineDepth, allowRecursiveInlining))
+        if (!DeciderInlineIntoInliner(inlinee, inliner, isConstructorCall, isPolymorphicCall, constantArgInfo, recursiveInlineDepth, allowRecursiveInlining, callSiteHeat))
         {
             return nullptr;
         }
@@ -715,7 +768,7 @@ bool InliningDecider::CanRecursivelyInline(Js::FunctionBody * inlinee, Js::Funct
 
 // This only enables collection of the inlinee data, we are much more aggressive here.
 // Actual decision of whether something is inlined or not is taken in CommitInlineIntoInliner
-bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool isConstructorCall, bool isPolymorphicCall, uint16 constantArgInfo, uint recursiveInlineDepth, bool allowRecursiveInlining)
+bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool isConstructorCall, bool isPolymorphicCall, uint16 constantArgInfo, uint recursiveInlineDepth, bool allowRecursiveInlining, CallSiteHeat callSiteHeat)
 {
 
     if (!CanRecursivelyInline(inlinee, inliner, allowRecursiveInlining, recursiveInlineDepth))
@@ -777,7 +830,10 @@ bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::F
     //       5b. If inlinee is monomorphic, inline only small constructors. They are governed by ConstructorInlineThreshold (21)
     // 7. Rule for inlinee which is not interpreted enough (as we might not have all the profile data):
     //       7a. As of now it is still governed by the InlineThreshold. Plan to play with this in future.
-    // 8. Rest should be inlined.
+    // 8. Rule for call edge frequency (see GetCallSiteHeat):
+    //       8a. Cold call sites don't get the second half of the InlineCountMax budget, it is kept for hotter call sites.
+    //       8b. Hot call sites have the resulting threshold scaled by HotCallSiteInlineScale.
+    // 9. Rest should be inlined.
 
     uint16 mask = constantArgInfo &  inlinee->m_argUsedForBranch;
     if (mask && inlineeByteCodeCount <  (uint)CONFIG_FLAG(ConstantArgumentInlineThreshold))
@@ -785,6 +841,23 @@ bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::F
         return true;
     }
 
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+    char16 debugStringBuffer2[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+    char16 debugStringBuffer3[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
+#endif
+
+    if (callSiteHeat == CallSiteHeat::Cold && this->bytecodeInlinedCount > (uint)threshold.inlineCountMax / 2)
+    {
+        INLINE_TESTTRACE(_u("INLINING: Skip Inline: Cold call site \tBytecode size: %d\tInlined bytecode count: %d\tInlinee: %s (%s)\tCaller: %s (%s) \tRoot: %s (%s)\n"),
+            inlinee->GetByteCodeCount(),
+            this->bytecodeInlinedCount,
+            inlinee->GetDisplayName(), inlinee->GetDebugNumberSet(debugStringBuffer),
+            inliner->GetDisplayName(), inliner->GetDebugNumberSet(debugStringBuffer2),
+            topFunc->GetDisplayName(), topFunc->GetDebugNumberSet(debugStringBuffer3));
+        return false;
+    }
+
     int inlineThreshold = threshold.inlineThreshold;
     if (!isPolymorphicCall && !isConstructorCall && IsInlineeLeaf(inlinee) && (inlinee->GetLoopCount() <= 2))
     {
@@ -799,12 +872,6 @@ bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::F
         }
     }
 
-#if ENABLE_DEBUG_CONFIG_OPTIONS
-    char16 debugStringBuffer[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
-    char16 debugStringBuffer2[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
-    char16 debugStringBuffer3[MAX_FUNCTION_BODY_DEBUG_STRING_SIZE];
-#endif
-
     if (inlinee->GetHasLoops())
     {
         if (threshold.loopInlineThreshold < 0 ||                                     // Negative LoopInlineThreshold disable inlining with loop
@@ -893,6 +960,11 @@ bool InliningDecider::DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::F
         }
     }
 
+    if (callSiteHeat == CallSiteHeat::Hot && inlineThreshold > 0)
+    {
+        inlineThreshold = (int)((int64)inlineThreshold * CONFIG_FLAG(HotCallSiteInlineScale) / 100);
+    }
+
     if (threshold.forLoopBody)
     {
         inlineThreshold /= CONFIG_FLAG(InlineInLoopBodyScaleDownFactor);
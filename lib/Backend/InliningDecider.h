@@ -16,9 +16,22 @@ class InliningDecider
     uint32 bytecodeInlinedCount;
     uint32 numberOfInlineesWithLoop;
 
+    // Hottest call site frequency of the last inliner queried by GetCallSiteHeat
+    Js::FunctionBody * callSiteHeatInliner;
+    uint32 callSiteHeatMaxFrequency;
+
 public:
     const ExecutionMode jitMode;      // Disable certain parts for certain JIT modes
 
+    // How often a call edge runs relative to the inliner's other profiled call edges
+    enum class CallSiteHeat : uint8
+    {
+        Unknown,
+        Cold,
+        Warm,
+        Hot
+    };
+
 public:
     InliningDecider(Js::FunctionBody *const topFunc, bool isLoopBody, bool isInDebugMode, const ExecutionMode jitMode);
     ~InliningDecider();
@@ -27,7 +40,7 @@ class InliningDecider
     bool InlineIntoTopFunc() const;
     bool InlineIntoInliner(Js::FunctionBody *const inliner) const;
 
-    Js::FunctionInfo *Inline(Js::FunctionBody *const inliner, Js::FunctionInfo* functionInfo, bool isConstructorCall, bool isPolymorphicCall, bool isCallback, uint16 constantArgInfo, Js::ProfileId callSiteId, uint recursiveInlineDepth, bool allowRecursiveInline);
+    Js::FunctionInfo *Inline(Js::FunctionBody *const inliner, Js::FunctionInfo* functionInfo, bool isConstructorCall, bool isPolymorphicCall, bool isCallback, uint16 constantArgInfo, Js::ProfileId callSiteId, uint recursiveInlineDepth, bool allowRecursiveInline, CallSiteHeat callSiteHeat = CallSiteHeat::Unknown);
     Js::FunctionInfo *InlineCallSite(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId, uint recursiveInlineDepth = 0);
     Js::FunctionInfo *GetCallSiteFuncInfo(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId, bool* isConstructorCall, bool* isPolymorphicCall);
     Js::FunctionInfo * InlineCallback(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId, uint recursiveInlineDepth);
@@ -36,11 +49,13 @@ class InliningDecider
     Js::FunctionInfo * GetCallApplyTargetInfo(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId);
     uint16 GetConstantArgInfo(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId);
     bool HasCallSiteInfo(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId);
+    CallSiteHeat GetCallSiteHeat(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId);
     uint InlinePolymorphicCallSite(Js::FunctionBody *const inliner, const Js::ProfileId profiledCallSiteId, Js::FunctionBody** functionBodyArray, uint functionBodyArrayLength, bool* canInlineArray, uint recursiveInlineDepth = 0);
     bool GetIsLoopBody() const { return isLoopBody;};
+    uint32 GetBytecodeInlinedCount() const { return bytecodeInlinedCount; }
     bool ContinueInliningUserDefinedFunctions(uint32 bytecodeInlinedCount) const;
     bool CanRecursivelyInline(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool allowRecursiveInlining, uint recursiveInlineDepth);
-    bool DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool isConstructorCall, bool isPolymorphicCall, uint16 constantArgInfo, uint recursiveInlineDepth, bool allowRecursiveInlining);
+    bool DeciderInlineIntoInliner(Js::FunctionBody * inlinee, Js::FunctionBody * inliner, bool isConstructorCall, bool isPolymorphicCall, uint16 constantArgInfo, uint recursiveInlineDepth, bool allowRecursiveInlining, CallSiteHeat callSiteHeat);
 
     void SetAggressiveHeuristics() { this->threshold.SetAggressiveHeuristics(); }
     void ResetInlineHeuristics() { this->threshold.Reset(); }
@@ -57,6 +72,8 @@ class InliningDecider
     {
         bytecodeInlinedCount = 0;
         numberOfInlineesWithLoop = 0;
+        callSiteHeatInliner = nullptr;
+        callSiteHeatMaxFrequency = 0;
     }
     uint32 GetNumberOfInlineesWithLoop() { return numberOfInlineesWithLoop; }
     void IncrementNumberOfInlineesWithLoop() { numberOfInlineesWithLoop++; }
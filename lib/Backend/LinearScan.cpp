@@ -3555,10 +3555,10 @@ LinearScan::GetSpillCost(Lifetime *lifetime)
         }
 
         if (this->curLoop && !lifetime->sym->IsConst()
-            && this->curLoop->regAlloc.liveOnBackEdgeSyms->Test(lifetime->sym->m_id))
+            && this->curLoop->regAlloc.liveOnBackEdgeSyms->Test(lifetime->sym->m_id)
+            && this->WasInRegAtLoopTop(lifetime))
         {
             // If we spill here, we'll need to insert a load at the bottom of the loop
-            // (it would be nice to be able to check is was in a reg at the top of the loop)...
             useCount += localUseCost;
         }
     }
@@ -3617,6 +3617,38 @@ LinearScan::GetSpillCost(Lifetime *lifetime)
     return spillCost;
 }
 
+// LinearScan::WasInRegAtLoopTop
+// Returns true if the lifetime was in a register at the top of the current loop. Back-edge compensation only
+// reloads lifetimes that the loop top expects in a register; one that was loaded or allocated inside the loop
+// can be spilled without adding a load to every iteration.
+bool
+LinearScan::WasInRegAtLoopTop(Lifetime *lifetime) const
+{
+    Assert(this->curLoop);
+
+    Lifetime ** loopTopRegContent = this->curLoop->regAlloc.loopTopRegContent;
+    if (loopTopRegContent == nullptr || PHASE_OFF(Js::RegLoopTopSpillCostPhase, this->func))
+    {
+        // Register content isn't tracked at this loop top; assume the worst.
+        return true;
+    }
+
+    if (lifetime->start > this->curLoop->regAlloc.loopStart)
+    {
+        return false;
+    }
+
+    FOREACH_REG(reg)
+    {
+        if (loopTopRegContent[reg] == lifetime)
+        {
+            return true;
+        }
+    } NEXT_REG;
+
+    return false;
+}
+
 bool
 LinearScan::RemoveDeadStores(IR::Instr *instr)
 {
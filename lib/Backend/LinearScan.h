@@ -209,6 +209,7 @@ class LinearScan
     uint                GetRemainingHelperLength(Lifetime *const lifetime);
     uint                CurrentOpHelperVisitedLength(IR::Instr *const currentInstr) const;
     IR::Instr *         TryHoistLoad(IR::Instr *instr, Lifetime *lifetime);
+    bool                WasInRegAtLoopTop(Lifetime *lifetime) const;
     bool                ClearLoopExitIfRegUnused(Lifetime *lifetime, RegNum reg, IR::BranchInstr *branchInstr, Loop *loop);
 
 #if DBG
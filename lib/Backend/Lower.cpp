@@ -989,6 +989,10 @@ Lowerer::LowerRange(IR::Instr *instrStart, IR::Instr *instrEnd, bool defaultDoFa
             this->LowerUnaryHelperMem(instr, IR::HelperOp_ToSpreadedFunctionArgument);
             break;
 
+        case Js::OpCode::BuiltInIteratorNext:
+            this->LowerBinaryHelperMem(instr, IR::HelperOp_BuiltInIteratorNext);
+            break;
+
         case Js::OpCode::Conv_Numeric:
         case Js::OpCode::Conv_Num:
             this->LowerConvNum(instr, noMathFastPath);
@@ -3820,14 +3824,18 @@ Lowerer::GenerateArrayAllocHelper(IR::Instr *instr, uint32 * psize, Js::ArrayCal
 
     if (ArrayType::HasInlineHeadSegment(count))
     {
+        // Start out with the head segment size that arrays allocated at this call site were seen to grow to
+        uint32 sizeHint = arrayInfo ? arrayInfo->GetHeadSegmentSizeHint() : 0;
         if (isArrayObjCtor)
         {
             uint32 allocCount = isNoArgs ? Js::SparseArraySegmentBase::SMALL_CHUNK_SIZE : count;
+            allocCount = max(allocCount, sizeHint);
             arrayAllocSize = Js::JavascriptArray::DetermineAllocationSizeForArrayObjects<ArrayType, 0>(allocCount, nullptr, &alignedHeadSegmentSize);
         }
         else
         {
             uint32 allocCount = count == 0 ? Js::SparseArraySegmentBase::SMALL_CHUNK_SIZE : count;
+            allocCount = max(allocCount, sizeHint);
             arrayAllocSize = Js::JavascriptArray::DetermineAllocationSize<ArrayType, 0>(allocCount, nullptr, &alignedHeadSegmentSize);
         }
 
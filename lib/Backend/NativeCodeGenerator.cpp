@@ -165,6 +165,13 @@ void NativeCodeGenerator::Close()
 
     this->isClosed = true;
 
+#if DBG_DUMP
+    if (CONFIG_FLAG(JitQueueStats))
+    {
+        scriptContext->GetThreadContext()->GetJitQueueStats()->Print();
+    }
+#endif
+
     Assert(!queuedFullJitWorkItems.Head());
     Assert(queuedFullJitWorkItemCount == 0);
 
@@ -1818,6 +1825,7 @@ NativeCodeGenerator::PrioritizedButNotYetProcessed(JsUtil::Job *const job)
             if(queuedFullJitWorkItem)
             {
                 queuedFullJitWorkItems.MoveToBeginning(queuedFullJitWorkItem);
+                queuedFullJitWorkItem->SetIsPrioritized(true);
             }
         }
     }
@@ -1878,6 +1886,13 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
 
     CodeGenWorkItem *const codeGenWork = static_cast<CodeGenWorkItem *>(job);
 
+    LARGE_INTEGER processStartTime;
+    processStartTime.QuadPart = 0;
+    if(scriptContext->GetThreadContext()->GetJitQueueStats()->IsTimingEnabled())
+    {
+        QueryPerformanceCounter(&processStartTime);
+    }
+
     switch (codeGenWork->Type())
     {
     case JsLoopBodyWorkItemType:
@@ -1898,6 +1913,7 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
         if (fn->ForceJITLoopBody() || !WorkItemExceedsJITLimits(codeGenWork))
         {
             CodeGen(pageAllocator, codeGenWork, foreground);
+            RecordJitQueueStats(codeGenWork, processStartTime);
             return true;
         }
         Js::EntryPointInfo * entryPoint = loopBodyCodeGenWorkItem->GetEntryPoint();
@@ -1910,6 +1926,7 @@ NativeCodeGenerator::Process(JsUtil::Job *const job, JsUtil::ParallelThreadData
         if (IS_PREJIT_ON() || Js::Configuration::Global.flags.ForceNative || !WorkItemExceedsJITLimits(codeGenWork))
         {
             CodeGen(pageAllocator, codeGenWork, foreground);
+            RecordJitQueueStats(codeGenWork, processStartTime);
             return true;
         }
 #if ENABLE_DEBUG_CONFIG_OPTIONS
@@ -2205,6 +2222,7 @@ NativeCodeGenerator::GetJobToProcessProactively()
             if(queuedFullJitWorkItem) // ignore OOM, this work item just won't be removed from the job processor's queue
             {
                 queuedFullJitWorkItems.LinkToBeginning(queuedFullJitWorkItem);
+                queuedFullJitWorkItem->SetIsPrioritized(false);
                 ++queuedFullJitWorkItemCount;
             }
             workItem->OnAddToJitQueue();
@@ -3158,6 +3176,7 @@ NativeCodeGenerator::GatherCodeGenData(Js::FunctionBody *const topFunctionBody,
         }
 #endif
         GatherCodeGenData<false>(recycler, topFunctionBody, functionBody, entryPoint, inliningDecider, objTypeSpecFldInfoList, jitTimeData, nullptr, function ? Js::VarTo<Js::JavascriptFunction>(function) : nullptr, 0);
+        workItem->SetInlinedByteCodeCount(inliningDecider.GetBytecodeInlinedCount());
 
         jitTimeData->sharedPropertyGuards = entryPoint->GetNativeEntryPointData()->GetSharedPropertyGuards(recycler, jitTimeData->sharedPropertyGuardCount);
 
@@ -3505,28 +3524,94 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
     AutoOptionalCriticalSection autoLock(lock ? Processor()->GetCriticalSection() : nullptr);
     scriptContext->GetThreadContext()->RegisterCodeGenRecyclableData(recyclableData);
 
-    // If we have added a lot of jobs that are still waiting to be jitted, remove the oldest job
-    // to ensure we do not spend time jitting stale work items.
+    // If we have added a lot of jobs that are still waiting to be jitted, remove the coldest job
+    // to ensure we do not spend time jitting lukewarm work items while hot ones wait. Only the jobs
+    // queued behind the last prioritized one (a loop body, or a function that was asked for again
+    // while queued) are candidates; when the tail itself is prioritized, it is the one removed. A
+    // function's interpreted count is a call count while a loop body's is an iteration count, so
+    // only jobs of the same kind as the tail are compared, and among equally cold jobs the one
+    // nearest the tail goes first.
+    JitQueueStats *const jitQueueStats = scriptContext->GetThreadContext()->GetJitQueueStats();
     const ExecutionMode jitMode = codeGenWorkItem->GetJitMode();
     if(jitMode == ExecutionMode::FullJit &&
         queuedFullJitWorkItemCount >= (unsigned int)CONFIG_FLAG(JitQueueThreshold))
     {
-        CodeGenWorkItem *const workItemRemoved = queuedFullJitWorkItems.Tail()->WorkItem();
+        QueuedFullJitWorkItem *queuedWorkItemRemoved = queuedFullJitWorkItems.Tail();
+        if(!queuedWorkItemRemoved->IsPrioritized())
+        {
+            const CodeGenWorkItemType victimType = queuedWorkItemRemoved->WorkItem()->Type();
+            uint coldestCount = queuedWorkItemRemoved->WorkItem()->GetInterpretedCount();
+            for(QueuedFullJitWorkItem *queuedWorkItem = queuedWorkItemRemoved->Previous();
+                queuedWorkItem != nullptr && !queuedWorkItem->IsPrioritized();
+                queuedWorkItem = queuedWorkItem->Previous())
+            {
+                if(queuedWorkItem->WorkItem()->Type() != victimType)
+                {
+                    continue;
+                }
+
+                const uint interpretedCount = queuedWorkItem->WorkItem()->GetInterpretedCount();
+                if(interpretedCount < coldestCount)
+                {
+                    queuedWorkItemRemoved = queuedWorkItem;
+                    coldestCount = interpretedCount;
+                }
+            }
+        }
+
+        CodeGenWorkItem *const workItemRemoved = queuedWorkItemRemoved->WorkItem();
         Assert(workItemRemoved->GetJitMode() == ExecutionMode::FullJit);
         if(Processor()->RemoveJob(workItemRemoved))
         {
-            queuedFullJitWorkItems.UnlinkFromEnd();
+            queuedFullJitWorkItems.Unlink(queuedWorkItemRemoved);
             --queuedFullJitWorkItemCount;
             workItemRemoved->OnRemoveFromJitQueue(this);
+            jitQueueStats->RecordDropped();
         }
     }
-    Processor()->AddJob(codeGenWorkItem, prioritize);   // This one can throw (really unlikely though), OOM specifically.
+    // With more than one background thread, start the largest full JIT jobs early so that a big function with a lot of
+    // inlined code is not left to compile on its own after the smaller jobs queued before it have drained from the other
+    // threads. A large job goes right behind the prioritized jobs that are still waiting, earlier large jobs included, so
+    // it neither overtakes them nor the large jobs queued before it. A single thread gets nothing from the reordering, so
+    // leave the queue in arrival order there.
+    bool isLargeWorkItem = false;
+    QueuedFullJitWorkItem *previousQueuedWorkItem = nullptr;
+    if(jitMode == ExecutionMode::FullJit &&
+        codeGenWorkItem->Type() == JsFunctionType &&
+        codeGenWorkItem->GetCompileByteCodeCount() >= (uint)CONFIG_FLAG(LargeJitWorkItemByteCodeCount) &&
+        Processor()->ProcessesInBackground() &&
+        static_cast<JsUtil::BackgroundJobProcessor *>(Processor())->GetThreadCount() > 1 &&
+        !PHASE_OFF(Js::LargeJitWorkItemFirstPhase, codeGenWorkItem->GetFunctionBody()))
+    {
+        isLargeWorkItem = true;
+        prioritize = true;
+
+        // Prioritized jobs that a background thread already took are no longer in the job processor's queue
+        JsUtil::BackgroundJobProcessor *const backgroundProcessor = static_cast<JsUtil::BackgroundJobProcessor *>(Processor());
+        for(QueuedFullJitWorkItem *queuedWorkItem = queuedFullJitWorkItems.Tail();
+            queuedWorkItem != nullptr;
+            queuedWorkItem = queuedWorkItem->Previous())
+        {
+            if(queuedWorkItem->IsPrioritized() && !backgroundProcessor->IsBeingProcessed(queuedWorkItem->WorkItem()))
+            {
+                previousQueuedWorkItem = queuedWorkItem;
+                break;
+            }
+        }
+    }
+
+    // This one can throw (really unlikely though), OOM specifically.
+    Processor()->AddJob(codeGenWorkItem, prioritize, previousQueuedWorkItem ? previousQueuedWorkItem->WorkItem() : nullptr);
     if(jitMode == ExecutionMode::FullJit)
     {
         QueuedFullJitWorkItem *const queuedFullJitWorkItem = codeGenWorkItem->EnsureQueuedFullJitWorkItem();
         if(queuedFullJitWorkItem) // ignore OOM, this work item just won't be removed from the job processor's queue
         {
-            if(prioritize)
+            if(previousQueuedWorkItem)
+            {
+                queuedFullJitWorkItems.LinkAfter(queuedFullJitWorkItem, previousQueuedWorkItem);
+            }
+            else if(prioritize)
             {
                 queuedFullJitWorkItems.LinkToBeginning(queuedFullJitWorkItem);
             }
@@ -3534,10 +3619,51 @@ void NativeCodeGenerator::AddToJitQueue(CodeGenWorkItem *const codeGenWorkItem,
             {
                 queuedFullJitWorkItems.LinkToEnd(queuedFullJitWorkItem);
             }
+            queuedFullJitWorkItem->SetIsPrioritized(
+                isLargeWorkItem || (prioritize && codeGenWorkItem->Type() == JsLoopBodyWorkItemType));
             ++queuedFullJitWorkItemCount;
+
+#if DBG
+            // No prioritized job that is still waiting comes after a large one, which keeps large jobs in arrival order
+            for(QueuedFullJitWorkItem *queuedWorkItem = isLargeWorkItem ? queuedFullJitWorkItem->Next() : nullptr;
+                queuedWorkItem != nullptr;
+                queuedWorkItem = queuedWorkItem->Next())
+            {
+                Assert(!queuedWorkItem->IsPrioritized() ||
+                    static_cast<JsUtil::BackgroundJobProcessor *>(Processor())->IsBeingProcessed(queuedWorkItem->WorkItem()));
+            }
+#endif
+            if(isLargeWorkItem && PHASE_TRACE(Js::LargeJitWorkItemFirstPhase, codeGenWorkItem->GetFunctionBody()))
+            {
+                TraceQueuedFullJitWorkItems(queuedFullJitWorkItem);
+            }
         }
     }
     codeGenWorkItem->OnAddToJitQueue();
+
+    jitQueueStats->RecordQueued(jitMode == ExecutionMode::FullJit ? JitQueueStats::FullJitTier : JitQueueStats::SimpleJitTier);
+    jitQueueStats->RecordQueueDepth(queuedFullJitWorkItemCount);
+}
+
+void NativeCodeGenerator::TraceQueuedFullJitWorkItems(QueuedFullJitWorkItem *const addedQueuedWorkItem) const
+{
+    // Lists the queued full JIT jobs from the first to be compiled to the last, marking the prioritized ones with '*' and
+    // the ones a background thread already took with '-'
+    JsUtil::BackgroundJobProcessor *const backgroundProcessor = static_cast<JsUtil::BackgroundJobProcessor *>(Processor());
+    Output::Print(_u("LargeJitWorkItemFirst: queued %s (%u bytecodes), full JIT queue:"),
+        addedQueuedWorkItem->WorkItem()->GetFunctionBody()->GetDisplayName(),
+        addedQueuedWorkItem->WorkItem()->GetCompileByteCodeCount());
+    for(QueuedFullJitWorkItem *queuedWorkItem = queuedFullJitWorkItems.Head();
+        queuedWorkItem != nullptr;
+        queuedWorkItem = queuedWorkItem->Next())
+    {
+        Output::Print(_u(" %s%s%s"),
+            queuedWorkItem->WorkItem()->GetFunctionBody()->GetDisplayName(),
+            queuedWorkItem->IsPrioritized() ? _u("*") : _u(""),
+            backgroundProcessor->IsBeingProcessed(queuedWorkItem->WorkItem()) ? _u("-") : _u(""));
+    }
+    Output::Print(_u("\n"));
+    Output::Flush();
 }
 
 void NativeCodeGenerator::AddWorkItem(CodeGenWorkItem* workitem)
@@ -3546,6 +3672,27 @@ void NativeCodeGenerator::AddWorkItem(CodeGenWorkItem* workitem)
     workItems.LinkToEnd(workitem);
 }
 
+void NativeCodeGenerator::RecordJitQueueStats(CodeGenWorkItem *const workItem, const LARGE_INTEGER &startTime)
+{
+    // The times are only taken once timing is enabled; a job queued or started before that counts as taking no time
+    LONG64 waitTicks = 0;
+    LONG64 compileTicks = 0;
+    if(startTime.QuadPart != 0)
+    {
+        LARGE_INTEGER endTime;
+        QueryPerformanceCounter(&endTime);
+        const LARGE_INTEGER queuedTime = workItem->GetQueuedTime();
+        waitTicks = queuedTime.QuadPart != 0 ? startTime.QuadPart - queuedTime.QuadPart : 0;
+        compileTicks = endTime.QuadPart - startTime.QuadPart;
+    }
+
+    // Process runs on the background thread, so the counters are updated with interlocked operations
+    scriptContext->GetThreadContext()->GetJitQueueStats()->RecordCompiled(
+        workItem->GetJitMode() == ExecutionMode::FullJit ? JitQueueStats::FullJitTier : JitQueueStats::SimpleJitTier,
+        waitTicks,
+        compileTicks);
+}
+
 Js::ScriptContextProfiler * NativeCodeGenerator::GetBackgroundCodeGenProfiler(PageAllocator *allocator)
 {
 #ifdef  PROFILE_EXEC
@@ -3759,7 +3906,8 @@ bool NativeCodeGenerator::TryAggressiveInlining(Js::FunctionBody *const topFunct
         }
         else
         {
-            inlinee = inliningDecider.Inline(inlineeFunctionBody, inlinee, isConstructorCall, false, false, inliningDecider.GetConstantArgInfo(inlineeFunctionBody, profiledCallSiteId), profiledCallSiteId, inlineeFunctionBody->GetFunctionInfo() == inlinee ? recursiveInlineDepth + 1 : 0, true);
+            inlinee = inliningDecider.Inline(inlineeFunctionBody, inlinee, isConstructorCall, false, false, inliningDecider.GetConstantArgInfo(inlineeFunctionBody, profiledCallSiteId), profiledCallSiteId, inlineeFunctionBody->GetFunctionInfo() == inlinee ? recursiveInlineDepth + 1 : 0, true,
+                inliningDecider.GetCallSiteHeat(inlineeFunctionBody, profiledCallSiteId));
             if (!inlinee)
             {
                 return false;
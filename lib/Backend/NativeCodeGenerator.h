@@ -198,6 +198,9 @@ void SetProfileMode(BOOL fSet);
     uint queuedFullJitWorkItemCount;
     uint byteCodeSizeGenerated;
 
+    void RecordJitQueueStats(CodeGenWorkItem *const workItem, const LARGE_INTEGER &startTime);
+    void TraceQueuedFullJitWorkItems(QueuedFullJitWorkItem *const addedQueuedWorkItem) const;
+
     bool isOptimizedForManyInstances;
     bool isClosed;
     bool hasUpdatedQForDebugMode;
@@ -4,7 +4,7 @@
 //-------------------------------------------------------------------------------------------------------
 #include "Backend.h"
 
-QueuedFullJitWorkItem::QueuedFullJitWorkItem(CodeGenWorkItem *const workItem) : workItem(workItem)
+QueuedFullJitWorkItem::QueuedFullJitWorkItem(CodeGenWorkItem *const workItem) : workItem(workItem), isPrioritized(false)
 {
     Assert(workItem->GetJitMode() == ExecutionMode::FullJit);
 }
@@ -13,3 +13,13 @@ CodeGenWorkItem *QueuedFullJitWorkItem::WorkItem() const
 {
     return workItem;
 }
+
+bool QueuedFullJitWorkItem::IsPrioritized() const
+{
+    return isPrioritized;
+}
+
+void QueuedFullJitWorkItem::SetIsPrioritized(const bool isPrioritized)
+{
+    this->isPrioritized = isPrioritized;
+}
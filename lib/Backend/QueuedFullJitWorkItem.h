@@ -10,10 +10,13 @@ class QueuedFullJitWorkItem : public JsUtil::DoublyLinkedListElement<QueuedFullJ
 {
 private:
     CodeGenWorkItem *const workItem;
+    bool isPrioritized;     // queued ahead of the ordinary full JIT work items, and not to be dropped for them
 
 public:
     QueuedFullJitWorkItem(CodeGenWorkItem *const workItem);
 
 public:
     CodeGenWorkItem *WorkItem() const;
+    bool IsPrioritized() const;
+    void SetIsPrioritized(const bool isPrioritized);
 };
@@ -1059,6 +1059,13 @@ ObjectTemp::IsTempUseOpCodeSym(IR::Instr * instr, Js::OpCode opcode, Sym * sym)
     // Special case FromVar for now until we can allow CallsValueOf opcode to be accept temp use
     case Js::OpCode::FromVar:
         return true;
+
+    // typeof and the object side of 'in' only inspect the object; neither calls valueOf/toString on it,
+    // so the object can't be handed to user code. (The key of 'in' can, so it must not be the temp.)
+    case Js::OpCode::Typeof:
+        return true;
+    case Js::OpCode::IsIn:
+        return instr->GetSrc2()->GetStackSym() == sym && instr->GetSrc1()->GetStackSym() != sym;
     }
 
     // TODO: Currently, when we disable implicit call, we still don't allow valueOf/toString that has no side effects
@@ -299,19 +299,22 @@ namespace JsUtil
         }
     }
 
-    void JobProcessor::AddJob(Job *const job, const bool prioritize)
+    void JobProcessor::AddJob(Job *const job, const bool prioritize, Job *const previousJob)
     {
         // This function is called from inside the lock
 
         Assert(job);
         Assert(managers.Contains(job->Manager()));
         Assert(!IsClosed());
+        Assert(!previousJob || jobs.Contains(previousJob));
 
         if (job->Manager()->numJobsAddedToProcessor + 1 == 0)
             Js::Throw::OutOfMemory();  // Overflow: job counts we use are int32's.
         ++job->Manager()->numJobsAddedToProcessor;
 
-        if (prioritize)
+        if (previousJob)
+            jobs.LinkAfter(job, previousJob);
+        else if (prioritize)
             jobs.LinkToBeginning(job);
         else
             jobs.LinkToEnd(job);
@@ -498,7 +501,8 @@ namespace JsUtil
         processor(nullptr),
         parser(nullptr),
         pse(nullptr),
-        scriptContextBG(nullptr)
+        scriptContextBG(nullptr),
+        numaNode(NUMA_NO_PREFERRED_NODE)
     {
     }
 
@@ -640,7 +644,8 @@ namespace JsUtil
         threadId(GetCurrentThreadContextId()),
         threadService(threadService),
         threadCount(0),
-        maxThreadCount(0)
+        maxThreadCount(0),
+        numaNode(NUMA_NO_PREFERRED_NODE)
 #if PDATA_ENABLED && defined(_WIN32)
         ,hasExtraWork(0)
 #endif
@@ -998,7 +1003,7 @@ namespace JsUtil
         criticalSection.Leave();
     }
 
-    void BackgroundJobProcessor::AddJob(Job *const job, const bool prioritize)
+    void BackgroundJobProcessor::AddJob(Job *const job, const bool prioritize, Job *const previousJob)
     {
         // This function is called from inside the lock
 
@@ -1010,7 +1015,7 @@ namespace JsUtil
             Js::Throw::OutOfMemory(); // Overflow: job counts we use are int32's.
         ++numJobs;
 
-        __super::AddJob(job, prioritize);
+        __super::AddJob(job, prioritize, previousJob);
         IndicateNewJob();
     }
 
@@ -1068,6 +1073,20 @@ namespace JsUtil
         return false;
     }
 
+    void BackgroundJobProcessor::UpdateThreadNumaNode(ParallelThreadData *threadData)
+    {
+        // Threads of a thread service belong to the host and are left where they are
+        const DWORD desiredNumaNode = this->numaNode;
+        if (threadData->numaNode == desiredNumaNode || threadService->HasCallback())
+        {
+            return;
+        }
+
+        AutoSystemInfo::SetCurrentThreadNumaNode(desiredNumaNode);
+        threadData->GetPageAllocator()->SetNumaNode(desiredNumaNode);
+        threadData->numaNode = desiredNumaNode;
+    }
+
     void BackgroundJobProcessor::Run(ParallelThreadData* threadData)
     {
         EDGE_ETW_INTERNAL(EventWriteJSCRIPT_NATIVECODEGEN_START(this, 0));
@@ -1132,6 +1151,7 @@ namespace JsUtil
 
                     criticalSection.Leave();
 
+                    UpdateThreadNumaNode(threadData);
                     const bool succeeded = Process(job, threadData);
 
                     criticalSection.Enter();
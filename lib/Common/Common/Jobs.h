@@ -338,9 +338,10 @@ namespace JsUtil
             TJobManager *const manager,
             const unsigned int milliseconds = INFINITE);
 
-        // Add a job to the queue, and optionally put it in front of the queue. Must be called from inside the lock. A job
-        // manager should use JobManager::AcquireLock and JobManager::ReleaseLock for this purpose.
-        virtual void AddJob(Job *const job, const bool prioritize = false);
+        // Add a job to the queue, and optionally put it in front of the queue, or right behind a job that is still in the
+        // queue. Must be called from inside the lock. A job manager should use JobManager::AcquireLock and
+        // JobManager::ReleaseLock for this purpose.
+        virtual void AddJob(Job *const job, const bool prioritize = false, Job *const previousJob = nullptr);
 
         // Must be called from inside the lock
         virtual bool RemoveJob(Job *const job);
@@ -439,6 +440,7 @@ namespace JsUtil
         Parser *parser;
         CompileScriptException *pse;
         Js::ScriptContext *scriptContextBG;
+        DWORD numaNode;                 //The NUMA node the thread is pinned to
 
         ParallelThreadData(AllocationPolicyManager* policyManager);
 
@@ -459,6 +461,7 @@ namespace JsUtil
         unsigned int threadCount;
         unsigned int maxThreadCount;
         ParallelThreadData **parallelThreadData;
+        DWORD numaNode;
 
 #if PDATA_ENABLED && defined(_WIN32)
         LONG hasExtraWork;
@@ -488,6 +491,7 @@ namespace JsUtil
         uint NumberOfThreadsWaitingForJobs ();
         Job* GetCurrentJobOfManager(JobManager *const manager);
         ParallelThreadData * GetThreadDataFromCurrentJob(Job* job);
+        void UpdateThreadNumaNode(ParallelThreadData *threadData);
 
         void InitializeThreadCount();
         void InitializeParallelThreadData(AllocationPolicyManager* policyManager, bool disableParallelThreads);
@@ -505,7 +509,7 @@ namespace JsUtil
             TJobManager *const manager,
             const unsigned int milliseconds = INFINITE);
 
-        virtual void AddJob(Job *const job, const bool prioritize = false) override;
+        virtual void AddJob(Job *const job, const bool prioritize = false, Job *const previousJob = nullptr) override;
         virtual bool RemoveJob(Job *const job) override;
 
         template<class TJobManager, class TJobHolder>
@@ -526,6 +530,10 @@ namespace JsUtil
         bool IsBeingProcessed(Job *job);
 
         CriticalSection * GetCriticalSection() { return &criticalSection; }
+        unsigned int GetThreadCount() const { return threadCount; }
+
+        // Dedicated threads move to the node before they process their next job
+        void SetNumaNode(DWORD numaNode) { this->numaNode = numaNode; }
 
         //Iterates each background thread, callback returns true when it needs to terminate the iteration.
         template<class Fn>
@@ -40,8 +40,10 @@ class FinalizableObject;
 #include "Memory/RecyclerWeakReference.h"
 #include "Memory/RecyclerSweep.h"
 #include "Memory/RecyclerSweepManager.h"
+#include "Memory/RecyclerAllocationSampler.h"
 #include "Memory/RecyclerHeuristic.h"
 #include "Memory/MarkContext.h"
 #include "Memory/MarkContextWrapper.h"
 #include "Memory/RecyclerWatsonTelemetry.h"
 #include "Memory/Recycler.h"
+#include "Memory/ThreadAllocationBuffer.h"
@@ -16,6 +16,7 @@
 #endif
 PHASE(All)
     PHASE(BGJit)
+        PHASE(LargeJitWorkItemFirst)
     PHASE(Module)
     PHASE(LibInit)
         PHASE(JsLibInit)
@@ -45,6 +46,7 @@ PHASE(All)
             PHASE(VariableIntEncoding)
         PHASE(NativeCodeSerialization)
         PHASE(OptimizeBlockScope)
+        PHASE(BuiltInIteratorNext)  //for-of steps built-in Map/Set iterators without allocating a result object
     PHASE(Delay)
         PHASE(Speculation)
         PHASE(GatherCodeGenData)
@@ -94,6 +96,7 @@ PHASE(All)
             PHASE(InlineCall)
             PHASE(InlineCallTarget)
             PHASE(PartialPolymorphicInline)
+            PHASE(InlineHotCallSites)       //Weighs inline candidates by how often their call site was profiled relative to the inliner's other call sites
             PHASE(PolymorphicInline)
             PHASE(PolymorphicInlineFixedMethods)
             PHASE(InlineOutsideLoops)
@@ -182,6 +185,7 @@ PHASE(All)
                     PHASE(NativeArrayConversion)
                     PHASE(CopyOnAccessArray)
                     PHASE(NativeArrayLeafSegment)
+                    PHASE(ArrayPresize)
                 PHASE(TypedArrayTypeSpec)
                 PHASE(LdLenIntSpec)
                 PHASE(FixDataProps)
@@ -257,6 +261,7 @@ PHASE(All)
                 PHASE(RegionUseCount)
                 PHASE(RegHoistLoads)
                 PHASE(ClearRegLoopExit)
+                PHASE(RegLoopTopSpillCost)  //Only charge a back-edge reload when spilling a lifetime that held a register at the loop top
         PHASE(Peeps)
         PHASE(Layout)
         PHASE(EHBailoutPatchUp)
@@ -304,6 +309,7 @@ PHASE(All)
             PHASE(ConcurrentPartialCollect)
             PHASE(ParallelMark)
             PHASE(PartialCollect)
+                PHASE(ScaledPartialCollectRescan)   //Let the rescan budget for partial collect grow with the heap
                 PHASE(ResetMarks)
                 PHASE(ResetWriteWatch)
                 PHASE(FindRoot)
@@ -320,6 +326,7 @@ PHASE(All)
                     PHASE(SweepSmall)
                     PHASE(SweepLarge)
                     PHASE(SweepPartialReuse)
+                    PHASE(SparseHeapBlockLast)      //Allocate from sparsely occupied heap blocks after the denser ones
                 PHASE(ConcurrentSweep)
                 PHASE(Finalize)
                 PHASE(Dispose)
@@ -495,6 +502,10 @@ PHASE(All)
 #define DEFAULT_CONFIG_LeafInlineThreshold  (60)            //Inlinee threshold for function which is leaf (irrespective of it has loops or not)
 #define DEFAULT_CONFIG_LoopInlineThreshold  (25)            //Inlinee threshold for function with loops
 #define DEFAULT_CONFIG_PolymorphicInlineThreshold  (35)     //Polymorphic inline threshold
+#define DEFAULT_CONFIG_HotCallSiteInlineMinCount  (64)     //Minimum number of profiled calls before a call site's frequency is used to weigh inlining
+#define DEFAULT_CONFIG_HotCallSiteInlinePercent   (50)     //A call site at least this percentage as frequent as the inliner's hottest call site is hot
+#define DEFAULT_CONFIG_HotCallSiteInlineScale     (150)    //Percentage by which the inline threshold is scaled for hot call sites
+#define DEFAULT_CONFIG_ColdCallSiteInlinePercent  (5)      //A call site less than this percentage as frequent as the inliner's hottest call site is cold
 #define DEFAULT_CONFIG_InlineCountMax       (1200)          //Max sum of bytecodes of inlinees inlined into a function (excluding built-ins)
 #define DEFAULT_CONFIG_InlineCountMaxInLoopBodies (500)     // Max sum of bytecodes of inlinees that can be inlined into a jitted loop body (excluding built-ins)
 #define DEFAULT_CONFIG_AggressiveInlineCountMax       (8000)          //Max sum of bytecodes of inlinees inlined into a function (excluding built-ins) when inlined aggressively
@@ -721,6 +732,7 @@ PHASE(All)
 #define DEFAULT_CONFIG_MaxJITFunctionBytecodeCount (120000)
 
 #define DEFAULT_CONFIG_JitQueueThreshold      (6)
+#define DEFAULT_CONFIG_LargeJitWorkItemByteCodeCount (3000)    // Full JIT work items with at least this much bytecode, inlinees included, go to the front of the jit queue
 
 #define DEFAULT_CONFIG_FullJitRequeueThreshold (25)     // Minimum number of times a function needs to be executed before it is re-added to the jit queue
 
@@ -1022,6 +1034,7 @@ FLAGNR(Boolean, CreateFunctionProxy   , "Create function proxies instead of full
 FLAGNR(Boolean, HybridFgJit           , "When background JIT is enabled, enable jitting in the foreground based on heuristics. This flag is only effective when OptimizeForManyInstances is disabled (UI threads).", DEFAULT_CONFIG_HybridFgJit)
 FLAGNR(Number,  HybridFgJitBgQueueLengthThreshold, "The background job queue length must exceed this threshold to consider jitting in the foreground", DEFAULT_CONFIG_HybridFgJitBgQueueLengthThreshold)
 FLAGNR(Boolean, BytecodeHist          , "Provide a histogram of the bytecodes run by the script. (NoNative required).", false)
+FLAGNR(Boolean, BytecodePairHist      , "Provide a histogram of adjacent bytecode pairs run by the script, to pick superinstruction candidates. (NoNative required).", false)
 FLAGNR(Boolean, CurrentSourceInfo     , "Enable IASD get current script source info", DEFAULT_CONFIG_CurrentSourceInfo)
 FLAGNR(Boolean, CFGLog                , "Log CFG checks", false)
 FLAGNR(Boolean, CheckAlignment        , "Insert checks in the native code to verify 8-byte alignment of stack", false)
@@ -1293,6 +1306,10 @@ FLAGNR(Number, GoptCleanupThreshold, "Number of instructions seen before we clea
 FLAGNR(Number, AsmGoptCleanupThreshold, "Number of instructions seen before we cleanup the value table", DEFAULT_CONFIG_AsmGoptCleanupThreshold)
 FLAGNR(Boolean, HighPrecisionDate, "Enable sub-millisecond resolution in Javascript Date for benchmark timing", DEFAULT_CONFIG_HighPrecisionDate)
 FLAGNR(Number,  InlineCountMax        , "Maximum count in bytecodes to inline in a given function", DEFAULT_CONFIG_InlineCountMax)
+FLAGNR(Number,  HotCallSiteInlineMinCount, "Minimum number of profiled calls before call site frequencies are used to weigh inlining", DEFAULT_CONFIG_HotCallSiteInlineMinCount)
+FLAGNR(Number,  HotCallSiteInlinePercent, "Frequency, as a percentage of the inliner's hottest call site, at which a call site is considered hot", DEFAULT_CONFIG_HotCallSiteInlinePercent)
+FLAGNR(Number,  HotCallSiteInlineScale, "Percentage by which the inline threshold is scaled for hot call sites", DEFAULT_CONFIG_HotCallSiteInlineScale)
+FLAGNR(Number,  ColdCallSiteInlinePercent, "Frequency, as a percentage of the inliner's hottest call site, below which a call site is considered cold", DEFAULT_CONFIG_ColdCallSiteInlinePercent)
 FLAGNRA(Number, InlineCountMaxInLoopBodies, icminlb, "Maximum count in bytecodes to inline in a given function", DEFAULT_CONFIG_InlineCountMaxInLoopBodies)
 FLAGNRA(Number, InlineInLoopBodyScaleDownFactor, iilbsdf, "Maximum depth of a recursive inline call", DEFAULT_CONFIG_InlineInLoopBodyScaleDownFactor)
 FLAGNR(Number,  InlineThreshold       , "Maximum size in bytecodes of an inline candidate", DEFAULT_CONFIG_InlineThreshold)
@@ -1305,6 +1322,8 @@ FLAGNR(Number,  AsmJsInlineAdjust       , "Adjustment in the maximum size in byt
 FLAGNR(String,  Interpret             , "List of functions to interpret", nullptr)
 FLAGNR(Phases,  Instrument            , "Instrument the generated code from the given phase", )
 FLAGNR(Number,  JitQueueThreshold     , "Max number of work items/script context in the jit queue", DEFAULT_CONFIG_JitQueueThreshold)
+FLAGNR(Number,  LargeJitWorkItemByteCodeCount, "Bytecode count, inlinees included, at which a full JIT work item is queued ahead of smaller ones when there are multiple jit threads", DEFAULT_CONFIG_LargeJitWorkItemByteCodeCount)
+FLAGNR(Boolean, JitQueueStats         , "Print the thread's JIT queue depth, drops, wait time and compile time per tier when a script context closes", false)
 #ifdef LEAK_REPORT
 FLAGNR(String,  LeakReport            , "File name for the leak report", nullptr)
 #endif
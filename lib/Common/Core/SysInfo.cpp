@@ -33,6 +33,7 @@ EXTERN_C IMAGE_DOS_HEADER __ImageBase;
 #endif
 
 AutoSystemInfo AutoSystemInfo::Data INIT_PRIORITY(300);
+THREAD_LOCAL DWORD_PTR AutoSystemInfo::unpinnedThreadAffinityMask = 0;
 
 #if DBG
 bool
@@ -96,6 +97,10 @@ AutoSystemInfo::Initialize()
 #endif
 
     InitPhysicalProcessorCount();
+    if (!GetNumaHighestNodeNumber(&highestNumaNodeNumber))
+    {
+        highestNumaNodeNumber = 0;
+    }
 #if DBG
     initialized = true;
 #endif
@@ -428,6 +433,51 @@ AutoSystemInfo::IsCRTModulePointer(uintptr_t ptr)
 }
 #endif
 
+//
+// Restricts the current thread to the processors of a NUMA node, or gives it back the affinity it had before it
+// was first pinned when given NUMA_NO_PREFERRED_NODE. Like the rest of the system info this only covers the first
+// processor group.
+//
+bool
+AutoSystemInfo::SetCurrentThreadNumaNode(DWORD numaNode)
+{
+    if (numaNode == NUMA_NO_PREFERRED_NODE)
+    {
+        if (unpinnedThreadAffinityMask == 0)
+        {
+            // Never pinned
+            return true;
+        }
+
+        if (::SetThreadAffinityMask(GetCurrentThread(), unpinnedThreadAffinityMask) == 0)
+        {
+            return false;
+        }
+
+        unpinnedThreadAffinityMask = 0;
+        return true;
+    }
+
+    ULONGLONG processorMask = 0;
+    if (numaNode > Data.highestNumaNodeNumber || !GetNumaNodeProcessorMask((UCHAR)numaNode, &processorMask) || processorMask == 0)
+    {
+        return false;
+    }
+
+    const DWORD_PTR previousMask = ::SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)processorMask);
+    if (previousMask == 0)
+    {
+        return false;
+    }
+
+    // Moving between nodes keeps the affinity from before the first pin
+    if (unpinnedThreadAffinityMask == 0)
+    {
+        unpinnedThreadAffinityMask = previousMask;
+    }
+    return true;
+}
+
 bool AutoSystemInfo::IsLowMemoryProcess()
 {
     ULONG64 commit = ULONG64(-1);
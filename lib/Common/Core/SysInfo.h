@@ -39,6 +39,8 @@ class AutoSystemInfo : public SYSTEM_INFO
     void SetAvailableCommit(ULONG64 commit);
     DWORD GetNumberOfLogicalProcessors() const { return this->dwNumberOfProcessors; }
     DWORD GetNumberOfPhysicalProcessors() const { return this->dwNumberOfPhysicalProcessors; }
+    ULONG GetHighestNumaNodeNumber() const { return this->highestNumaNodeNumber; }
+    static bool SetCurrentThreadNumaNode(DWORD numaNode);
 
 #ifdef _WIN32
     bool IsCRTModulePointer(uintptr_t ptr);
@@ -105,6 +107,7 @@ class AutoSystemInfo : public SYSTEM_INFO
     bool armDivAvailable;
 #endif
     DWORD dwNumberOfPhysicalProcessors;
+    ULONG highestNumaNodeNumber;
 
     bool disableDebugScopeCapture;
 #if DBG
@@ -119,6 +122,9 @@ class AutoSystemInfo : public SYSTEM_INFO
 
     bool InitPhysicalProcessorCount();
 
+    // Affinity the current thread had before SetCurrentThreadNumaNode first pinned it; 0 while it is not pinned
+    THREAD_LOCAL static DWORD_PTR unpinnedThreadAffinityMask;
+
     WCHAR binaryName[MAX_PATH + 1];
     DWORD majorVersion;
     DWORD minorVersion;
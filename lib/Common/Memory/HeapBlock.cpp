@@ -1972,11 +1972,11 @@ SmallHeapBlockT<TBlockAttributes>::MarkImplicitRoots()
 
 template <class TBlockAttributes>
 void
-SmallHeapBlockT<TBlockAttributes>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+SmallHeapBlockT<TBlockAttributes>::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
-    ForEachAllocatedObject(infoBits, [=](uint index, void * objectAddress)
+    ForEachAllocatedObject([=](uint index, void * objectAddress)
     {
-        CallBackFunction(objectAddress, this->objectSize);
+        callback(callbackState, objectAddress, this->objectSize, (ObjectInfoBits)this->ObjectInfo(index));
     });
 }
 
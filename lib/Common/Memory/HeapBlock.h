@@ -178,6 +178,9 @@ enum ObjectInfoBits : unsigned short
     EnumClassMask               = EnumClass_1_Bit,
 };
 
+// Called for every allocated object when enumerating the heap; attributes are the bits stored for the object
+typedef void (*ObjectEnumerationCallback)(void * callbackState, void * address, size_t size, ObjectInfoBits attributes);
+
 
 enum ResetMarkFlags
 {
@@ -722,6 +725,7 @@ class SmallHeapBlockT : public HeapBlock
     uint GetObjectSize() const { return objectSize; }
     uint GetObjectCount() const { return objectCount; }
     uint GetMarkedCount() const { return markCount; }
+    uint GetFreeCount() const { return freeCount; }
 
     // Valid during sweep time
     ushort GetExpectedFreeObjectCount() const;
@@ -775,7 +779,7 @@ class SmallHeapBlockT : public HeapBlock
 
     void Reset();
 
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
 
     bool IsImplicitRoot(uint objectIndex)
     {
@@ -1187,6 +1187,7 @@ HeapBlockMap32::Cleanup(bool concurrentFindImplicitRoot)
 HeapBlockMap64::HeapBlockMap64():
     list(nullptr)
 {
+    memset(nodeDirectory, 0, sizeof(nodeDirectory));
 }
 
 HeapBlockMap64::~HeapBlockMap64()
@@ -1200,6 +1201,15 @@ HeapBlockMap64::~HeapBlockMap64()
         NoMemProtectHeapDelete(node);
         node = next;
     }
+
+    for (uint i = 0; i < NodeDirectoryCount; i++)
+    {
+        if (nodeDirectory[i] != nullptr)
+        {
+            NoMemProtectHeapDelete(nodeDirectory[i]);
+            nodeDirectory[i] = nullptr;
+        }
+    }
 }
 
 bool
@@ -1388,6 +1398,12 @@ HeapBlockMap64::FindOrInsertNode(void * address)
         if (node != nullptr)
         {
             node->nodeIndex = GetNodeIndex(address);
+            if (!SetDirectoryNode(node->nodeIndex, node))
+            {
+                NoMemProtectHeapDelete(node);
+                return nullptr;
+            }
+
             node->next = list;
 #ifdef _M_ARM64
             // For ARM we need to make sure that the list remains traversable during this insert.
@@ -1403,8 +1419,12 @@ HeapBlockMap64::FindOrInsertNode(void * address)
 HeapBlockMap64::Node *
 HeapBlockMap64::FindNode(void * address) const
 {
-    uint index = GetNodeIndex(address);
+    return GetNode(GetNodeIndex(address));
+}
 
+HeapBlockMap64::Node *
+HeapBlockMap64::FindNodeInList(uint index) const
+{
     Node * node = list;
     while (node != nullptr)
     {
@@ -1419,6 +1439,45 @@ HeapBlockMap64::FindNode(void * address) const
     return nullptr;
 }
 
+bool
+HeapBlockMap64::SetDirectoryNode(uint index, Node * node)
+{
+    const uint directoryIndex = index >> NodeDirectoryLeafBits;
+    if (directoryIndex >= NodeDirectoryCount)
+    {
+        // Only reachable through the list
+        return true;
+    }
+
+    NodeDirectoryLeaf * leaf = nodeDirectory[directoryIndex];
+    if (leaf == nullptr)
+    {
+        if (node == nullptr)
+        {
+            return true;
+        }
+
+        leaf = NoMemProtectHeapNewNoThrowZ(NodeDirectoryLeaf);
+        if (leaf == nullptr)
+        {
+            return false;
+        }
+
+#ifdef _M_ARM64
+        // Concurrent marking may read the directory, make sure the leaf is zeroed before it is published.
+        MemoryBarrier();
+#endif
+        // Leaves are kept until the map is destroyed, a concurrent mark may be looking at one.
+        nodeDirectory[directoryIndex] = leaf;
+    }
+
+#ifdef _M_ARM64
+    MemoryBarrier();
+#endif
+    leaf->nodes[index & (NodeDirectoryLeafCount - 1)] = node;
+    return true;
+}
+
 void
 HeapBlockMap64::ResetMarks()
 {
@@ -1512,6 +1571,7 @@ HeapBlockMap64::Cleanup(bool concurrentFindImplicitRoot)
             // Concurrent traversals of the node list would result in a race and possible UAF.
             // Currently we simply defer node free for the lifetime of the heap (only affects MemProtect).
             *prevnext = node->next;
+            SetDirectoryNode(node->nodeIndex, nullptr);
             NoMemProtectHeapDelete(node);
         }
         else
@@ -303,12 +303,39 @@ class HeapBlockMap64
 
     Node * FindOrInsertNode(void * address);
     Node * FindNode(void * address) const;
+    Node * FindNodeInList(uint index) const;
+    bool SetDirectoryNode(uint index, Node * node);
+
+    Node * GetNode(uint index) const
+    {
+        const uint directoryIndex = index >> NodeDirectoryLeafBits;
+        if (directoryIndex >= NodeDirectoryCount)
+        {
+            return FindNodeInList(index);
+        }
+
+        const NodeDirectoryLeaf * leaf = nodeDirectory[directoryIndex];
+        return leaf != nullptr ? leaf->nodes[index & (NodeDirectoryLeafCount - 1)] : nullptr;
+    }
 
     template <class Fn>
     void ForEachNodeInAddressRange(void * address, size_t pageCount, Fn fn);
 
     Node * list;
 
+    // Two level index from node index to node, so that looking up the node for a mark candidate does not walk the list.
+    // It covers the low 2^48 bytes of address space; nodes above that are only found through the list.
+    static const uint NodeDirectoryLeafBits = 8;
+    static const uint NodeDirectoryLeafCount = 1 << NodeDirectoryLeafBits;
+    static const uint NodeDirectoryCount = 1 << (48 - 32 - NodeDirectoryLeafBits);
+
+    struct NodeDirectoryLeaf
+    {
+        Node * nodes[NodeDirectoryLeafCount];
+    };
+
+    NodeDirectoryLeaf * nodeDirectory[NodeDirectoryCount];
+
 public:
 #if DBG
     ushort GetPageMarkCount(void * address) const;
@@ -477,23 +477,15 @@ HeapBlockMap64::Mark(void * candidate, MarkContext * markContext)
     {
         return;
     }
-    uint index = GetNodeIndex(candidate);
 
-    Node * node = list;
-    while (node != nullptr)
+    Node * node = GetNode(GetNodeIndex(candidate));
+    if (node == nullptr)
     {
-        if (node->nodeIndex == index)
-        {
-            // Found the correct Node.
-            // Process the mark and return.
-            node->map.Mark<interlocked, doSpecialMark>(candidate, markContext);
-            return;
-        }
-
-        node = node->next;
+        // No Node found; must be an invalid reference. Do nothing.
+        return;
     }
 
-    // No Node found; must be an invalid reference. Do nothing.
+    node->map.Mark<interlocked, doSpecialMark>(candidate, markContext);
 }
 
 template <bool interlocked, bool doSpecialMark>
@@ -505,23 +497,15 @@ HeapBlockMap64::MarkInterior(void * candidate, MarkContext * markContext)
     {
         return;
     }
-    uint index = GetNodeIndex(candidate);
 
-    Node * node = list;
-    while (node != nullptr)
+    Node * node = GetNode(GetNodeIndex(candidate));
+    if (node == nullptr)
     {
-        if (node->nodeIndex == index)
-        {
-            // Found the correct Node.
-            // Process the mark and return.
-            node->map.MarkInterior<interlocked, doSpecialMark>(candidate, markContext);
-            return;
-        }
-
-        node = node->next;
+        // No Node found; must be an invalid reference. Do nothing.
+        return;
     }
 
-    // No Node found; must be an invalid reference. Do nothing.
+    node->map.MarkInterior<interlocked, doSpecialMark>(candidate, markContext);
 }
 
 #endif // defined(TARGET_64)
@@ -1420,9 +1420,70 @@ HeapBucketT<TBlockType>::StartAllocationAfterSweep()
 {
     Assert(this->IsAllocationStopped());
     this->isAllocationStopped = false;
+    this->MoveSparseHeapBlocksToEnd();
     this->nextAllocableBlockHead = this->heapBlockList;
 }
 
+// Objects are never moved (we scan conservatively), so the only way to get the pages of a mostly empty
+// block back is to let the rest of its objects die. Allocating into the densest blocks first keeps the
+// sparse ones from being topped up again, giving them a chance to become empty and be released.
+template <typename TBlockType>
+void
+HeapBucketT<TBlockType>::MoveSparseHeapBlocksToEnd()
+{
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (CUSTOM_PHASE_OFF1(this->GetRecycler()->GetRecyclerFlagsTable(), Js::SparseHeapBlockLastPhase))
+    {
+        return;
+    }
+#endif
+
+    TBlockType * denseList = nullptr;
+    TBlockType * denseTail = nullptr;
+    TBlockType * sparseList = nullptr;
+    TBlockType * sparseTail = nullptr;
+
+    HeapBlockList::ForEachEditing(this->heapBlockList, [&](TBlockType * heapBlock)
+    {
+        // Sparse: less than a quarter of the objects in the block are live
+        const uint liveCount = heapBlock->GetObjectCount() - heapBlock->GetFreeCount();
+        if (liveCount * 4 < heapBlock->GetObjectCount())
+        {
+            if (sparseTail == nullptr)
+            {
+                sparseList = heapBlock;
+            }
+            else
+            {
+                sparseTail->SetNextBlock(heapBlock);
+            }
+            sparseTail = heapBlock;
+        }
+        else
+        {
+            if (denseTail == nullptr)
+            {
+                denseList = heapBlock;
+            }
+            else
+            {
+                denseTail->SetNextBlock(heapBlock);
+            }
+            denseTail = heapBlock;
+        }
+    });
+
+    if (sparseList == nullptr || denseList == nullptr)
+    {
+        // Nothing to reorder; the links were rewritten to the same blocks in the same order
+        return;
+    }
+
+    denseTail->SetNextBlock(sparseList);
+    sparseTail->SetNextBlock(nullptr);
+    this->heapBlockList = denseList;
+}
+
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
 template <typename TBlockType>
 void
@@ -1859,17 +1920,17 @@ HeapBucketT<TBlockType>::AppendAllocableHeapBlockList(TBlockType * list)
 
 template <typename TBlockType>
 void
-HeapBucketT<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+HeapBucketT<TBlockType>::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
     UpdateAllocators();
-    HeapBucket::EnumerateObjects(fullBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(fullBlockList, callback, callbackState);
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP && SUPPORT_WIN32_SLIST
     if (CONFIG_FLAG_RELEASE(EnableConcurrentSweepAlloc) && !this->IsAnyFinalizableBucket())
     {
-        HeapBucket::EnumerateObjects(sweepableHeapBlockList, infoBits, CallBackFunction);
+        HeapBucket::EnumerateObjects(sweepableHeapBlockList, callback, callbackState);
     }
 #endif
-    HeapBucket::EnumerateObjects(heapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(heapBlockList, callback, callbackState);
 }
 
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
@@ -2184,17 +2245,17 @@ HeapBucketGroup<TBlockAttributes>::TransferDisposedObjects()
 
 template <class TBlockAttributes>
 void
-HeapBucketGroup<TBlockAttributes>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+HeapBucketGroup<TBlockAttributes>::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
-    heapBucket.EnumerateObjects(infoBits, CallBackFunction);
-    leafHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
+    heapBucket.EnumerateObjects(callback, callbackState);
+    leafHeapBucket.EnumerateObjects(callback, callbackState);
 #ifdef RECYCLER_WRITE_BARRIER
-    smallNormalWithBarrierHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
-    smallFinalizableWithBarrierHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
+    smallNormalWithBarrierHeapBucket.EnumerateObjects(callback, callbackState);
+    smallFinalizableWithBarrierHeapBucket.EnumerateObjects(callback, callbackState);
 #endif
-    finalizableHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
+    finalizableHeapBucket.EnumerateObjects(callback, callbackState);
 #ifdef RECYCLER_VISITED_HOST
-    recyclerVisitedHostHeapBucket.EnumerateObjects(infoBits, CallBackFunction);
+    recyclerVisitedHostHeapBucket.EnumerateObjects(callback, callbackState);
 #endif
 }
 
@@ -71,7 +71,7 @@ class HeapBucket
     uint GetMediumBucketIndex() const;
 
     template <typename TBlockType>
-    static void EnumerateObjects(TBlockType * heapBlockList, ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size));
+    static void EnumerateObjects(TBlockType * heapBlockList, ObjectEnumerationCallback callback, void * callbackState);
 
 protected:
     HeapInfo * heapInfo;
@@ -266,6 +266,7 @@ class HeapBucketT : public HeapBucket
     bool AllowAllocationsDuringConcurrentSweep();
     void StopAllocationBeforeSweep();
     void StartAllocationAfterSweep();
+    void MoveSparseHeapBlocksToEnd();
     bool IsAllocationStopped() const;
 
     void SweepHeapBlockList(RecyclerSweep& recyclerSweep, TBlockType * heapBlockList, bool allocable);
@@ -275,7 +276,7 @@ class HeapBucketT : public HeapBucket
 #endif
 
     // Partial/Concurrent GC
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
 
 
     void AssertCheckHeapBlockNotInAnyList(TBlockType * heapBlock);
@@ -345,11 +346,11 @@ class HeapBucketT : public HeapBucket
 
 template <typename TBlockType>
 void
-HeapBucket::EnumerateObjects(TBlockType * heapBlockList, ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+HeapBucket::EnumerateObjects(TBlockType * heapBlockList, ObjectEnumerationCallback callback, void * callbackState)
 {
     HeapBlockList::ForEach(heapBlockList, [=](TBlockType * heapBlock)
     {
-        heapBlock->EnumerateObjects(infoBits, CallBackFunction);
+        heapBlock->EnumerateObjects(callback, callbackState);
     });
 }
 
@@ -1583,46 +1583,46 @@ HeapInfo::TransferDisposedObjects()
     largeObjectBucket.TransferDisposedObjects();
 }
 void
-HeapInfo::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+HeapInfo::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
     for (uint i = 0; i < HeapConstants::BucketCount; i++)
     {
-        heapBuckets[i].EnumerateObjects(infoBits, CallBackFunction);
+        heapBuckets[i].EnumerateObjects(callback, callbackState);
     }
 
 #ifdef BUCKETIZE_MEDIUM_ALLOCATIONS
     for (uint i = 0; i < HeapConstants::MediumBucketCount; i++)
     {
-        mediumHeapBuckets[i].EnumerateObjects(infoBits, CallBackFunction);
+        mediumHeapBuckets[i].EnumerateObjects(callback, callbackState);
     }
 #endif
 
-    largeObjectBucket.EnumerateObjects(infoBits, CallBackFunction);
+    largeObjectBucket.EnumerateObjects(callback, callbackState);
 
 #if ENABLE_CONCURRENT_GC
-    HeapBucket::EnumerateObjects(newLeafHeapBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(newNormalHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newLeafHeapBlockList, callback, callbackState);
+    HeapBucket::EnumerateObjects(newNormalHeapBlockList, callback, callbackState);
 #ifdef RECYCLER_WRITE_BARRIER
-    HeapBucket::EnumerateObjects(newNormalWithBarrierHeapBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(newFinalizableWithBarrierHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newNormalWithBarrierHeapBlockList, callback, callbackState);
+    HeapBucket::EnumerateObjects(newFinalizableWithBarrierHeapBlockList, callback, callbackState);
 #endif
 
 #ifdef RECYCLER_VISITED_HOST
-    HeapBucket::EnumerateObjects(newRecyclerVisitedHostHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newRecyclerVisitedHostHeapBlockList, callback, callbackState);
 #endif
-    HeapBucket::EnumerateObjects(newFinalizableHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newFinalizableHeapBlockList, callback, callbackState);
 
-    HeapBucket::EnumerateObjects(newMediumLeafHeapBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(newMediumNormalHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newMediumLeafHeapBlockList, callback, callbackState);
+    HeapBucket::EnumerateObjects(newMediumNormalHeapBlockList, callback, callbackState);
 #ifdef RECYCLER_WRITE_BARRIER
-    HeapBucket::EnumerateObjects(newMediumNormalWithBarrierHeapBlockList, infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(newMediumFinalizableWithBarrierHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newMediumNormalWithBarrierHeapBlockList, callback, callbackState);
+    HeapBucket::EnumerateObjects(newMediumFinalizableWithBarrierHeapBlockList, callback, callbackState);
 #endif
 
 #ifdef RECYCLER_VISITED_HOST
-    HeapBucket::EnumerateObjects(newMediumRecyclerVisitedHostHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newMediumRecyclerVisitedHostHeapBlockList, callback, callbackState);
 #endif
-    HeapBucket::EnumerateObjects(newMediumFinalizableHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(newMediumFinalizableHeapBlockList, callback, callbackState);
 #endif
 }
 
@@ -2044,6 +2044,16 @@ HeapInfo::DisablePageReuse()
     });
 }
 #endif
+
+void
+HeapInfo::SetNumaNode(DWORD numaNode)
+{
+    ForEachPageAllocator([=](IdleDecommitPageAllocator* pageAlloc)
+    {
+        pageAlloc->SetNumaNode(numaNode);
+    });
+}
+
 #if DBG
 bool
 HeapInfo::AllocatorsAreEmpty()
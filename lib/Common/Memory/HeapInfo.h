@@ -37,7 +37,7 @@ class HeapInfo
 #endif
 
     void ResetMarks(ResetMarkFlags flags);
-    void EnumerateObjects(ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
 #ifdef RECYCLER_PAGE_HEAP
     bool IsPageHeapEnabled() const{ return isPageHeapEnabled; }
     static size_t RoundObjectSize(size_t objectSize)
@@ -555,6 +555,7 @@ class HeapInfo
 #ifdef RECYCLER_NO_PAGE_REUSE
      void DisablePageReuse();
 #endif
+     void SetNumaNode(DWORD numaNode);
 private:
     template<typename Action>
     void ForEachPageAllocator(Action action)
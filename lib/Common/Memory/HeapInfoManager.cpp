@@ -313,11 +313,11 @@ HeapInfoManager::TransferDisposedObjects()
 }
 
 void
-HeapInfoManager::EnumerateObjects(ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size))
+HeapInfoManager::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
     ForEachHeapInfo([=](HeapInfo& heapInfo)
     {
-        heapInfo.EnumerateObjects(infoBits, CallBackFunction);
+        heapInfo.EnumerateObjects(callback, callbackState);
     });
 }
 
@@ -414,6 +414,15 @@ HeapInfoManager::DisablePageReuse()
     });
 }
 #endif
+
+void
+HeapInfoManager::SetNumaNode(DWORD numaNode)
+{
+    ForEachHeapInfo([=](HeapInfo& heapInfo)
+    {
+        heapInfo.SetNumaNode(numaNode);
+    });
+}
 }
 
 #ifdef ENABLE_MEM_STATS
@@ -75,7 +75,7 @@ class HeapInfoManager
     void DisposeObjects();
     void TransferDisposedObjects();
 
-    void EnumerateObjects(ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
 #if DBG
     bool AllocatorsAreEmpty();
 #endif
@@ -154,6 +154,7 @@ class HeapInfoManager
 #ifdef RECYCLER_NO_PAGE_REUSE
     void DisablePageReuse();
 #endif
+    void SetNumaNode(DWORD numaNode);
 
 #ifdef RECYCLER_PAGE_HEAP
     bool DoCaptureAllocCallStack();
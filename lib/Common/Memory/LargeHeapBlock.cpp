@@ -2122,7 +2122,7 @@ LargeHeapBlock::FinishPartialCollect(Recycler * recycler)
 #endif
 
 void
-LargeHeapBlock::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+LargeHeapBlock::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
     for (uint i = 0; i < allocCount; i++)
     {
@@ -2131,10 +2131,7 @@ LargeHeapBlock::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunctio
         {
             continue;
         }
-        if ((header->GetAttributes(this->heapInfo->recycler->Cookie) & infoBits) != 0)
-        {
-            CallBackFunction(header->GetAddress(), header->objectSize);
-        }
+        callback(callbackState, header->GetAddress(), header->objectSize, (ObjectInfoBits)header->GetAttributes(this->heapInfo->recycler->Cookie));
     }
 }
 
@@ -191,7 +191,7 @@ class LargeHeapBlock sealed : public HeapBlock
     static size_t GetPagesNeeded(DECLSPEC_GUARD_OVERFLOW size_t size, bool multiplyRequest);
     static uint GetMaxLargeObjectCount(size_t pageCount, size_t firstAllocationSize);
 
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
 
 #if ENABLE_MEM_STATS
     void AggregateBlockStats(HeapBucketStats& stats);
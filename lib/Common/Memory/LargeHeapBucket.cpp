@@ -1000,23 +1000,23 @@ LargeHeapBucket::TransferDisposedObjects()
 }
 
 void
-LargeHeapBucket::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+LargeHeapBucket::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
-    HeapBucket::EnumerateObjects(largeBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(largeBlockList, callback, callbackState);
 #ifdef RECYCLER_PAGE_HEAP
-    HeapBucket::EnumerateObjects(largePageHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(largePageHeapBlockList, callback, callbackState);
 #endif
-    HeapBucket::EnumerateObjects(fullLargeBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(fullLargeBlockList, callback, callbackState);
 
     // Pending dispose large block list need not be null
     // When we enumerate over this list, anything that has been swept/finalized won't be
     // enumerated since it needs to have the object header for enumeration
     // and we set the header to null upon sweep/finalize
-    HeapBucket::EnumerateObjects(pendingDisposeLargeBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(pendingDisposeLargeBlockList, callback, callbackState);
 #if ENABLE_CONCURRENT_GC
     Assert(this->pendingSweepLargeBlockList == nullptr);
 #if ENABLE_PARTIAL_GC
-    HeapBucket::EnumerateObjects(partialSweptLargeBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(partialSweptLargeBlockList, callback, callbackState);
 #endif
 #endif
 }
@@ -63,7 +63,7 @@ class LargeHeapBucket: public HeapBucket
     void DisposeObjects();
     void TransferDisposedObjects();
 
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
 
     void Verify();
     void VerifyMark();
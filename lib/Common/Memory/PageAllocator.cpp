@@ -81,6 +81,25 @@ SegmentBase<T>::~SegmentBase()
     }
 }
 
+// Only memory reserved directly with VirtualAlloc can be placed on a NUMA node. The other virtual allocators carve
+// segments out of a shared reservation or a section, so they ignore the node.
+template<typename TVirtualAlloc>
+static LPVOID
+ReserveSegmentPages(TVirtualAlloc * virtualAllocator, size_t pageCount, DWORD allocationType, bool isCustomHeapAllocation, DWORD numaNode)
+{
+    return virtualAllocator->AllocPages(NULL, pageCount, allocationType, PAGE_READWRITE, isCustomHeapAllocation);
+}
+
+static LPVOID
+ReserveSegmentPages(VirtualAllocWrapper * virtualAllocator, size_t pageCount, DWORD allocationType, bool isCustomHeapAllocation, DWORD numaNode)
+{
+    if (numaNode == NUMA_NO_PREFERRED_NODE || isCustomHeapAllocation)
+    {
+        return virtualAllocator->AllocPages(NULL, pageCount, allocationType, PAGE_READWRITE, isCustomHeapAllocation);
+    }
+    return virtualAllocator->AllocPagesOnNumaNode(NULL, pageCount, allocationType, PAGE_READWRITE, numaNode);
+}
+
 template<typename T>
 bool
 SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
@@ -123,7 +142,8 @@ SegmentBase<T>::Initialize(DWORD allocFlags, bool excludeGuardPages)
         return false;
     }
 
-    this->address = (char *)GetAllocator()->GetVirtualAllocator()->AllocPages(NULL, totalPages, MEM_RESERVE | allocFlags, PAGE_READWRITE, this->IsInCustomHeapAllocator());
+    this->address = (char *)ReserveSegmentPages(GetAllocator()->GetVirtualAllocator(), totalPages, MEM_RESERVE | allocFlags,
+        this->IsInCustomHeapAllocator(), GetAllocator()->GetNumaNode());
 
     if (this->address == nullptr)
     {
@@ -708,6 +728,7 @@ PageAllocatorBase<TVirtualAlloc, TSegment, TPageSegment>::PageAllocatorBase(Allo
     , numberOfSegments(0)
     , processHandle(processHandle)
     , enableWriteBarrier(enableWriteBarrier)
+    , numaNode(NUMA_NO_PREFERRED_NODE)
 #ifdef ENABLE_BASIC_TELEMETRY
     ,decommitStats(nullptr)
 #endif
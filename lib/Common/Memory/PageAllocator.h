@@ -15,13 +15,13 @@ struct PageMemoryData;
 #endif
 
 #if !FLOATVAR
-class CodeGenNumberThreadAllocator;
 struct XProcNumberPageSegmentManager;
 #endif
 
 namespace Memory
 {
 typedef void* FunctionTableHandle;
+enum ObjectInfoBits : unsigned short;
 
 #if DBG_DUMP
 
@@ -494,8 +494,8 @@ template<> inline PageAllocatorBaseCommon::AllocatorType PageAllocatorBaseCommon
 template<typename TVirtualAlloc, typename TSegment, typename TPageSegment>
 class PageAllocatorBase: public PageAllocatorBaseCommon
 {
+    template <typename TObject, ObjectInfoBits attributes> friend class ThreadAllocationBuffer;
 #if !FLOATVAR
-    friend class ::CodeGenNumberThreadAllocator;
     friend struct ::XProcNumberPageSegmentManager;
 #endif
     // Allowing recycler to report external memory allocation.
@@ -709,6 +709,10 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     bool DisableAllocationOutOfMemory() const { return disableAllocationOutOfMemory; }
     void ResetDisableAllocationOutOfMemory() { disableAllocationOutOfMemory = false; }
 
+    // Segments reserved from now on prefer this node for their physical memory; existing segments stay where they are
+    void SetNumaNode(DWORD numaNode) { this->numaNode = numaNode; }
+    DWORD GetNumaNode() const { return numaNode; }
+
 #ifdef RECYCLER_MEMORY_VERIFY
     void EnableVerify() { verifyEnabled = true; }
 #endif
@@ -842,6 +846,7 @@ class PageAllocatorBase: public PageAllocatorBaseCommon
     bool disableAllocationOutOfMemory;
     bool excludeGuardPages;
     bool enableWriteBarrier;
+    DWORD numaNode;
     AllocationPolicyManager * policyManager;
 
     Js::ConfigFlagsTable& pageAllocatorFlagTable;
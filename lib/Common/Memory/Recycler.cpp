@@ -129,6 +129,7 @@ Recycler::Recycler(AllocationPolicyManager * policyManager, IdleDecommitPageAllo
     disableCollectOnAllocationHeuristics(false),
     skipStack(false),
     mainThreadHandle(NULL),
+    numaNode(NUMA_NO_PREFERRED_NODE),
 #if ENABLE_CONCURRENT_GC
     backgroundFinishMarkCount(0),
     hasPendingUnpinnedObject(false),
@@ -568,6 +569,15 @@ Recycler::SetIsThreadBound()
     stackBase = GetStackBase();
 }
 
+void
+Recycler::SetNumaNode(DWORD numaNode)
+{
+    // The recycler's own helper threads move to the node the next time they are woken up;
+    // threads of a host thread service are left where the host put them.
+    this->numaNode = numaNode;
+    this->autoHeap.SetNumaNode(numaNode);
+}
+
 void
 Recycler::RootAddRef(void* obj, uint *count)
 {
@@ -2731,7 +2741,7 @@ Recycler::RootMark(CollectionState markState)
         // to modify scannedRootBytes here, correct?
 #if ENABLE_PARTIAL_GC
         // return large root scanned byte to not get into partial mode if we are low on memory
-        scannedRootBytes = RecyclerSweepManager::MaxPartialCollectRescanRootBytes + 1;
+        scannedRootBytes = RecyclerSweepManager::MaxScaledPartialCollectRescanRootBytes + 1;
 #endif
     }
 
@@ -3197,6 +3207,8 @@ Recycler::SweepWeakReference()
         return true;
     });
 
+    this->allocationSampler.Sweep(this);
+
 #if defined(GCETW) && defined(ENABLE_JS_ETW)
     uint regionScannedCount = 0;
     uint regionClearedCount = 0;
@@ -4302,10 +4314,81 @@ void Recycler::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction
     }
 #endif
 
-    autoHeap.EnumerateObjects(infoBits, CallBackFunction);
+    struct EnumerateObjectsState
+    {
+        ObjectInfoBits infoBits;
+        void (*CallBackFunction)(void * address, size_t size);
+
+        static void Callback(void * callbackState, void * address, size_t size, ObjectInfoBits attributes)
+        {
+            EnumerateObjectsState * state = (EnumerateObjectsState *)callbackState;
+            if ((attributes & state->infoBits) != 0)
+            {
+                state->CallBackFunction(address, size);
+            }
+        }
+    };
+
+    EnumerateObjectsState state = { infoBits, CallBackFunction };
+    autoHeap.EnumerateObjects(&EnumerateObjectsState::Callback, &state);
     // GC-TODO: Explicit heap?
 }
 
+bool
+Recycler::EnumerateLiveObjects(ObjectEnumerationCallback callback, void * callbackState)
+{
+    if (this->isHeapEnumInProgress || this->isCollectionDisabled)
+    {
+        return false;
+    }
+
+    EnsureNotCollecting();
+
+    bool isExited = (this->collectionState == CollectionStateExit);
+    if (isExited)
+    {
+        this->SetCollectionState(CollectionStateNotCollecting);
+    }
+
+    struct EnumerateLiveObjectsState
+    {
+        Recycler * recycler;
+        ObjectEnumerationCallback callback;
+        void * callbackState;
+
+        static void Callback(void * callbackState, void * address, size_t size, ObjectInfoBits attributes)
+        {
+            EnumerateLiveObjectsState * state = (EnumerateLiveObjectsState *)callbackState;
+
+            // Allocated objects the mark did not reach are garbage waiting for the next sweep
+            if (state->recycler->heapBlockMap.IsMarked(address))
+            {
+                state->callback(state->callbackState, address, size, attributes);
+            }
+        }
+    };
+
+    {
+        Recycler::AutoSetupRecyclerForNonCollectingMark autoSetupRecyclerForNonCollectingMark(*this);
+
+        this->Mark();
+        this->SetCollectionState(CollectionStateNotCollecting);
+
+        // Nothing may be allocated or collected while the mark bits are being read
+        AutoBooleanToggle collectionDisabled(&this->isCollectionDisabled);
+        AutoBooleanToggle heapEnumInProgress(&this->isHeapEnumInProgress);
+
+        EnumerateLiveObjectsState state = { this, callback, callbackState };
+        autoHeap.EnumerateObjects(&EnumerateLiveObjectsState::Callback, &state);
+    }
+
+    if (isExited)
+    {
+        this->SetCollectionState(CollectionStateExit);
+    }
+    return true;
+}
+
 BOOL
 Recycler::IsMarkState() const
 {
@@ -6398,6 +6481,7 @@ Recycler::ThreadProc()
 #if defined(DBG) && defined(PROFILE_EXEC)
     this->backgroundProfilerPageAllocator.SetConcurrentThreadId(::GetCurrentThreadId());
 #endif
+    DWORD threadNumaNode = NUMA_NO_PREFERRED_NODE;
 #ifdef IDLE_DECOMMIT_ENABLED
     DWORD handleCount = this->concurrentIdleDecommitEvent? 2 : 1;
     HANDLE handles[2] = { this->concurrentWorkReadyEvent, this->concurrentIdleDecommitEvent };
@@ -6467,6 +6551,7 @@ Recycler::ThreadProc()
             break;
         }
 
+        this->UpdateHelperThreadNumaNode(&threadNumaNode);
         DoBackgroundWork();
     }
     while (true);
@@ -6484,6 +6569,19 @@ Recycler::ThreadProc()
     }
 }
 
+void
+Recycler::UpdateHelperThreadNumaNode(DWORD * threadNumaNode)
+{
+    // Called on a helper thread before it does work; threadNumaNode is the node that thread is pinned to
+    const DWORD desiredNumaNode = this->numaNode;
+    if (*threadNumaNode != desiredNumaNode)
+    {
+        // If the thread can't be pinned it keeps running wherever it was; don't retry on every wake up
+        AutoSystemInfo::SetCurrentThreadNumaNode(desiredNumaNode);
+        *threadNumaNode = desiredNumaNode;
+    }
+}
+
 #endif //ENABLE_CONCURRENT_GC
 
 #if ENABLE_ALLOCATIONS_DURING_CONCURRENT_SWEEP
@@ -7032,6 +7130,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
 
         // If this thread is created on demand we already have work to process and do not need to wait
         bool mustWait = parallelThread->synchronizeOnStartup;
+        DWORD threadNumaNode = NUMA_NO_PREFERRED_NODE;
 
         do
         {
@@ -7050,6 +7149,7 @@ RecyclerParallelThread::StaticThreadProc(LPVOID lpParameter)
             }
 
             // Invoke the workFunc to do real work
+            recycler->UpdateHelperThreadNumaNode(&threadNumaNode);
             (recycler->*workFunc)();
 
             // We always wait after the first time
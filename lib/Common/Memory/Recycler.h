@@ -671,8 +671,8 @@ class Recycler
     friend class ActiveScriptProfilerHeapEnum;
 #endif
     friend class ScriptEngineBase;  // This is for disabling GC for certain Host operations.
+    template <typename TObject, ObjectInfoBits attributes> friend class ThreadAllocationBuffer;
 #if !FLOATVAR
-    friend class ::CodeGenNumberThreadAllocator;
     friend struct ::XProcNumberPageSegmentManager;
 #endif
 public:
@@ -829,6 +829,7 @@ class Recycler
 #if ENABLE_WEAK_REFERENCE_REGIONS
     SList<RecyclerWeakReferenceRegion, HeapAllocator> weakReferenceRegionList;
 #endif
+    RecyclerAllocationSampler allocationSampler;
 
     void * transientPinnedObject;
 #if defined(CHECK_MEMORY_LEAK) || defined(LEAK_REPORT)
@@ -905,6 +906,7 @@ class Recycler
     RecyclerCollectionWrapper * collectionWrapper;
 
     HANDLE mainThreadHandle;
+    DWORD numaNode;
     void * stackBase;
     class SavedRegisterState
     {
@@ -1195,6 +1197,7 @@ class Recycler
     void SetMemProtectMode();
     bool IsMemProtectMode();
     size_t GetUsedBytes();
+    RecyclerAllocationSampler * GetAllocationSampler() { return &this->allocationSampler; }
     void LogMemProtectHeapSize(bool fromGC);
     char* Realloc(void* buffer, DECLSPEC_GUARD_OVERFLOW size_t existingBytes, DECLSPEC_GUARD_OVERFLOW size_t requestedBytes, bool truncate = true);
 #ifdef NTBUILD
@@ -1220,6 +1223,8 @@ class Recycler
 #endif
 
     void SetIsThreadBound();
+    void SetNumaNode(DWORD numaNode);
+    DWORD GetNumaNode() const { return this->numaNode; }
     void SetIsScriptActive(bool isScriptActive);
     void SetIsInScript(bool isInScript);
     bool HasNativeGCHost() const;
@@ -1238,6 +1243,7 @@ class Recycler
     template <CollectionFlags flags>
     BOOL FinishConcurrent();
     void ShutdownThread();
+    void UpdateHelperThreadNumaNode(DWORD * threadNumaNode);
 
     bool EnableConcurrent(JsUtil::ThreadService *threadService, bool startAllThreads);
     void DisableConcurrent();
@@ -1474,6 +1480,10 @@ class Recycler
 
     void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
 
+    // Marks the heap without collecting and calls back for each object found reachable. Heap enumeration is in
+    // progress for the duration of the callbacks, so they must not allocate from this recycler.
+    bool EnumerateLiveObjects(ObjectEnumerationCallback callback, void * callbackState);
+
     void RootAddRef(void* obj, uint *count = nullptr);
     void RootRelease(void* obj, uint *count = nullptr);
 
@@ -0,0 +1,95 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "CommonMemoryPch.h"
+
+RecyclerAllocationSampler::RecyclerAllocationSampler() :
+    bytesUntilNextSample(SIZE_MAX),
+    samplingInterval(0),
+    callback(nullptr),
+    callbackState(nullptr),
+    randomState(0),
+    samples(&NoThrowHeapAllocator::Instance)
+{
+}
+
+void
+RecyclerAllocationSampler::Start(size_t samplingInterval, SampleCallback callback, void * callbackState)
+{
+    Assert(samplingInterval != 0);
+    Assert(callback != nullptr);
+
+    // Samples taken for a previous client would carry tags it handed out
+    this->samples.Clear();
+
+    this->samplingInterval = samplingInterval;
+    this->callback = callback;
+    this->callbackState = callbackState;
+
+    // The seed only needs to differ between runs; it is not used for anything security related
+    this->randomState = ((uint64)::GetTickCount() << 32) ^ (uint64)(size_t)this;
+    if (this->randomState == 0)
+    {
+        this->randomState = 1;
+    }
+
+    this->bytesUntilNextSample = this->GetNextSampleDistance();
+}
+
+void
+RecyclerAllocationSampler::Stop()
+{
+    this->bytesUntilNextSample = SIZE_MAX;
+    this->samplingInterval = 0;
+    this->callback = nullptr;
+    this->callbackState = nullptr;
+    this->samples.Clear();
+}
+
+size_t
+RecyclerAllocationSampler::GetNextSampleDistance()
+{
+    // xorshift64
+    uint64 x = this->randomState;
+    x ^= x << 13;
+    x ^= x >> 7;
+    x ^= x << 17;
+    this->randomState = x;
+
+    // Uniform in (0, 1], using the top 53 bits so the value is exact in a double
+    const double uniform = ((x >> 11) + 1) * (1.0 / 9007199254740992.0);
+    const double distance = -log(uniform) * (double)this->samplingInterval;
+    return distance < 1.0 ? 1 : (size_t)distance;
+}
+
+void
+RecyclerAllocationSampler::TakeSample(void * address, size_t size)
+{
+    Assert(this->IsEnabled());
+
+    // The object is reported once however many sample points fall inside it. The distances are memoryless,
+    // so the distance to the next sample point past the object can be drawn fresh.
+    this->bytesUntilNextSample = this->GetNextSampleDistance();
+
+    Sample sample;
+    sample.address = address;
+    sample.size = size;
+    sample.tag = this->callback(this->callbackState, address, size);
+
+    // Losing a sample under memory pressure only makes the profile less precise
+    this->samples.Prepend(sample);
+}
+
+void
+RecyclerAllocationSampler::Sweep(Recycler * recycler)
+{
+    auto iterator = this->samples.GetEditingIterator();
+    while (iterator.Next())
+    {
+        if (!recycler->IsObjectMarked(iterator.Data().address))
+        {
+            iterator.RemoveCurrent();
+        }
+    }
+}
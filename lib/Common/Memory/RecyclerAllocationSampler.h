@@ -0,0 +1,78 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+class Recycler;
+
+// Picks allocations at random, on average one every samplingInterval bytes, and keeps track of the
+// picked objects until the recycler collects them. The distance between two samples is drawn from an
+// exponential distribution, so every byte allocated has the same chance of being sampled regardless of
+// the size of the object it belongs to.
+class RecyclerAllocationSampler
+{
+public:
+    // Called from inside the allocation of the sampled object, before it is initialized. The callback must
+    // not allocate from the recycler. The returned tag is stored with the sample.
+    typedef uint (*SampleCallback)(void * callbackState, void * address, size_t size);
+
+    RecyclerAllocationSampler();
+
+    void Start(size_t samplingInterval, SampleCallback callback, void * callbackState);
+    void Stop();
+    bool IsEnabled() const { return this->callback != nullptr; }
+    size_t GetSamplingInterval() const { return this->samplingInterval; }
+
+    void RecordAllocation(void * address, size_t size)
+    {
+        // Sampling is almost always off, so the allocation paths only pay for this one well predicted branch
+        if (!this->IsEnabled())
+        {
+            return;
+        }
+
+        if (size < this->bytesUntilNextSample)
+        {
+            this->bytesUntilNextSample -= size;
+            return;
+        }
+
+        this->TakeSample(address, size);
+    }
+
+    // Drop the samples of objects that were not marked; called before the sweep frees them
+    void Sweep(Recycler * recycler);
+
+    template <typename Fn>
+    void MapLiveSamples(Fn fn)
+    {
+        auto iterator = this->samples.GetIterator();
+        while (iterator.Next())
+        {
+            const Sample& sample = iterator.Data();
+            fn(sample.address, sample.size, sample.tag);
+        }
+    }
+
+private:
+    struct Sample
+    {
+        void * address;
+        size_t size;
+        uint tag;
+    };
+
+    void TakeSample(void * address, size_t size);
+    size_t GetNextSampleDistance();
+
+    size_t bytesUntilNextSample;
+    size_t samplingInterval;
+    SampleCallback callback;
+    void * callbackState;
+    uint64 randomState;
+    SList<Sample, NoThrowHeapAllocator> samples;
+};
+}
@@ -11,8 +11,13 @@
 
 const uint RecyclerSweepManager::MinPartialUncollectedNewPageCount = 4 MEGABYTES_OF_PAGES;
 const uint RecyclerSweepManager::MaxPartialCollectRescanRootBytes = 5 MEGABYTES;
+const uint RecyclerSweepManager::MaxScaledPartialCollectRescanRootBytes = 64 MEGABYTES;
 static const uint MinPartialCollectRescanRootBytes = 128 KILOBYTES;
 
+// A partial collect is worth it as long as rescanning the dirty pages is a small fraction of the work of marking
+// the whole heap again: allow rescanning up to 1/16 of the used bytes
+static const uint PartialCollectRescanRootBytesHeapDivisor = 16;
+
 // Maximum unused partial collect free bytes before we get out of partial GC mode
 static const uint MaxUnusedPartialCollectFreeBytes = 16 MEGABYTES;
 
@@ -83,6 +88,7 @@ RecyclerSweepManager::BeginSweep(Recycler * recycler)
     // such that we can have the decision before sweep.
 
     this->rescanRootBytes = rescanRootBytes;
+    this->maxPartialCollectRescanRootBytes = this->GetMaxPartialCollectRescanRootBytes();
 
     RECYCLER_STATS_SET(recycler, rescanRootBytes, rescanRootBytes);
 
@@ -384,9 +390,28 @@ RecyclerSweepManager::SubtractSweepNewObjectAllocBytes(size_t newObjectExpectSwe
 }
 
 
+/*--------------------------------------------------------------------------------------------
+* The rescan budget for a partial collect: 5MB, or 1/16 of the used heap bytes if that is larger,
+* capped at 64MB. With a large old heap, a full collect has to mark all of it again while a
+* partial collect only rescans the dirty pages, so a bigger heap can afford a bigger rescan.
+*--------------------------------------------------------------------------------------------*/
+size_t
+RecyclerSweepManager::GetMaxPartialCollectRescanRootBytes() const
+{
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+    if (CUSTOM_PHASE_OFF1(recycler->GetRecyclerFlagsTable(), Js::ScaledPartialCollectRescanPhase))
+    {
+        return MaxPartialCollectRescanRootBytes;
+    }
+#endif
+
+    const size_t heapScaledRescanRootBytes = recycler->autoHeap.GetUsedBytes() / PartialCollectRescanRootBytesHeapDivisor;
+    return min(max(heapScaledRescanRootBytes, (size_t)MaxPartialCollectRescanRootBytes), (size_t)MaxScaledPartialCollectRescanRootBytes);
+}
+
 /*--------------------------------------------------------------------------------------------
 * Determine we want to go into partial collect mode for the next GC before we sweep,
-* based on the number bytes needed to rescan (<= 5MB)
+* based on the number bytes needed to rescan (see GetMaxPartialCollectRescanRootBytes)
 *--------------------------------------------------------------------------------------------*/
 bool
 RecyclerSweepManager::DoPartialCollectMode()
@@ -403,7 +428,7 @@ RecyclerSweepManager::DoPartialCollectMode()
         return false;
     }
 
-    return this->rescanRootBytes <= MaxPartialCollectRescanRootBytes;
+    return this->rescanRootBytes <= this->maxPartialCollectRescanRootBytes;
 }
 
 // Heuristic ratio is ((c * e + (1 - e)) * (1 - p)) + p and use that to linearly scale between min and max
@@ -417,7 +442,7 @@ RecyclerSweepManager::AdjustPartialHeuristics()
     Assert(this->InPartialCollect() || recycler->autoHeap.unusedPartialCollectFreeBytes == 0);
 
     // DoPartialCollectMode should have rejected these already
-    Assert(this->rescanRootBytes <= (size_t)MaxPartialCollectRescanRootBytes);
+    Assert(this->rescanRootBytes <= this->maxPartialCollectRescanRootBytes);
     Assert(recycler->autoHeap.unusedPartialCollectFreeBytes <= MaxUnusedPartialCollectFreeBytes);
 
     // Page reuse Heuristics
@@ -467,12 +492,12 @@ RecyclerSweepManager::AdjustPartialHeuristics()
     RECYCLER_STATS_SET(recycler, estimatedPartialReuseBytes, estimatedPartialReuseBytes);
 
     // Recheck the rescanRootBytes
-    if (newRescanRootBytes > MaxPartialCollectRescanRootBytes)
+    if (newRescanRootBytes > this->maxPartialCollectRescanRootBytes)
     {
         return false;
     }
 
-    double collectCost = (double)newRescanRootBytes / MaxPartialCollectRescanRootBytes;
+    double collectCost = (double)newRescanRootBytes / this->maxPartialCollectRescanRootBytes;
 
     RECYCLER_STATS_SET(recycler, collectCost, collectCost);
 
@@ -39,6 +39,7 @@ class RecyclerSweepManager
     bool InPartialCollect() const;
     void StartPartialCollectMode();
     bool DoPartialCollectMode();
+    size_t GetMaxPartialCollectRescanRootBytes() const;
     bool DoAdjustPartialHeuristics() const;
     bool AdjustPartialHeuristics();
     void SubtractSweepNewObjectAllocBytes(size_t newObjectExpectSweepByteCount);
@@ -53,6 +54,7 @@ class RecyclerSweepManager
 
     static const uint MinPartialUncollectedNewPageCount; // 4MB pages
     static const uint MaxPartialCollectRescanRootBytes; // 5MB
+    static const uint MaxScaledPartialCollectRescanRootBytes; // 64MB
 #endif
 
 private:
@@ -72,6 +74,7 @@ class RecyclerSweepManager
 
     // Sweep data for partial activation heuristic
     size_t rescanRootBytes;
+    size_t maxPartialCollectRescanRootBytes;
     size_t reuseHeapBlockCount;
     size_t reuseByteCount;
 
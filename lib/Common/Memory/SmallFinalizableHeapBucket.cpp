@@ -173,10 +173,10 @@ SmallFinalizableHeapBucketBaseT<TBlockType>::TransferDisposedObjects()
 
 template <class TBlockType>
 void
-SmallFinalizableHeapBucketBaseT<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, void(*CallBackFunction)(void * address, size_t size))
+SmallFinalizableHeapBucketBaseT<TBlockType>::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
-    __super::EnumerateObjects(infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(this->pendingDisposeList, infoBits, CallBackFunction);
+    __super::EnumerateObjects(callback, callbackState);
+    HeapBucket::EnumerateObjects(this->pendingDisposeList, callback, callbackState);
 }
 
 #ifdef RECYCLER_SLOW_CHECK_ENABLED
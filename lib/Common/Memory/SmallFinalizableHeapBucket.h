@@ -23,7 +23,7 @@ class SmallFinalizableHeapBucketBaseT : public SmallNormalHeapBucketBase<THeapBl
     void AggregateBucketStats();
 #endif
 protected:
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
 
     friend class HeapBucket;
     template <class TBlockAttributes>
@@ -397,7 +397,7 @@ class HeapBucketGroup
     void SweepFinalizableObjects(RecyclerSweep& recyclerSweep);
     void DisposeObjects();
     void TransferDisposedObjects();
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
     void FinalizeAllObjects();
     static unsigned int GetHeapBucketOffset() { return offsetof(HeapBucketGroup<TBlockAttributes>, heapBucket); }
 
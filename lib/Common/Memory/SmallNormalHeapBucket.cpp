@@ -663,12 +663,12 @@ SmallNormalHeapBucketBase<TBlockType>::FinishPartialCollect(RecyclerSweep * recy
 
 template <typename TBlockType>
 void
-SmallNormalHeapBucketBase<TBlockType>::EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size))
+SmallNormalHeapBucketBase<TBlockType>::EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState)
 {
-    __super::EnumerateObjects(infoBits, CallBackFunction);
-    HeapBucket::EnumerateObjects(partialHeapBlockList, infoBits, CallBackFunction);
+    __super::EnumerateObjects(callback, callbackState);
+    HeapBucket::EnumerateObjects(partialHeapBlockList, callback, callbackState);
 #if ENABLE_CONCURRENT_GC
-    HeapBucket::EnumerateObjects(partialSweptHeapBlockList, infoBits, CallBackFunction);
+    HeapBucket::EnumerateObjects(partialSweptHeapBlockList, callback, callbackState);
 #endif
 }
 
@@ -49,7 +49,7 @@ class SmallNormalHeapBucketBase : public HeapBucketT<TBlockType>
     void SweepPartialReusePages(RecyclerSweep& recyclerSweep);
     void FinishPartialCollect(RecyclerSweep * recyclerSweep);
 
-    void EnumerateObjects(ObjectInfoBits infoBits, void (*CallBackFunction)(void * address, size_t size));
+    void EnumerateObjects(ObjectEnumerationCallback callback, void * callbackState);
 
 #if DBG
     void ResetMarks(ResetMarkFlags flags);
@@ -0,0 +1,211 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+namespace Memory
+{
+/****************************************************************************
+ * ThreadAllocationBuffer
+ *
+ *   Recycler can't be used by multiple threads. This buffer lets another
+ *   thread allocate recycler objects of one type, with no attributes other
+ *   than the leaf bit. It is the block and segment handling that used to be
+ *   private to CodeGenNumberThreadAllocator, which is still its only user:
+ *   background JIT numbers and number chunks. Results of the background
+ *   parser are finalizable, so they can't be allocated from it.
+ *   It reserves page segments for the recycler's page allocator itself and
+ *   commits blocks in them one at a time, so allocating never touches the
+ *   recycler. The memory is handed to the heap bucket of the object's size
+ *   the next time the recycler's thread calls Integrate, which must be from
+ *   a pre-collection callback.
+ *
+ *   The segments can be integrated back to the recycler's page allocator
+ *   right away, as all their pages are marked as used. A block is only
+ *   integrated whole, with every object in it live, so it must not be
+ *   integrated before the recycler can see the references that keep its
+ *   objects alive. Blocks therefore go through these lists:
+ *
+ *     filledBlocks:             the block has no room left
+ *     sealedBlocks:             Seal was called after the block filled up;
+ *                               the owner knows that what will keep its
+ *                               objects alive is set up at the next Flush
+ *     pendingIntegrationBlocks: Flush was called after the block was sealed;
+ *                               Integrate hands the block to the recycler
+ *
+ *   A block that is not full is never integrated. Memory in it stays with
+ *   the buffer until it fills up or the buffer is destroyed.
+ *
+ *   The buffer is not thread safe. The owner has to make sure Alloc, Seal,
+ *   Flush and Integrate don't run at the same time.
+ *
+ ****************************************************************************/
+template <typename TObject, ObjectInfoBits attributes>
+class ThreadAllocationBuffer
+{
+    CompileAssert(attributes == NoBit || attributes == LeafBit);
+
+public:
+    ThreadAllocationBuffer(Recycler * recycler) :
+        recycler(recycler), currentSegment(nullptr), segmentEnd(nullptr), currentBlockEnd(nullptr),
+        nextObject(nullptr), hasCurrentBlock(false), pendingIntegrationSegmentCount(0), pendingIntegrationSegmentPageCount(0)
+    {
+    }
+
+    ~ThreadAllocationBuffer()
+    {
+        pendingIntegrationSegments.Clear(&NoThrowNoMemProtectHeapAllocator::Instance);
+        pendingIntegrationBlocks.Clear(&NoThrowHeapAllocator::Instance);
+        sealedBlocks.Clear(&NoThrowHeapAllocator::Instance);
+        filledBlocks.Clear(&NoThrowHeapAllocator::Instance);
+    }
+
+    // Returns uninitialized memory for an object; throws on out of memory
+    TObject * Alloc()
+    {
+        const size_t sizeCat = GetAllocSize();
+        if (nextObject + sizeCat > currentBlockEnd)
+        {
+            AllocNewBlock();
+        }
+        TObject * newObject = (TObject *)nextObject;
+#ifdef RECYCLER_MEMORY_VERIFY
+        recycler->FillCheckPad(newObject, sizeof(TObject), sizeCat);
+#endif
+
+        nextObject += sizeCat;
+        return newObject;
+    }
+
+    bool HasFilledBlocks() const { return !filledBlocks.Empty(); }
+    void Seal() { filledBlocks.MoveTo(&sealedBlocks); }
+    void Flush() { sealedBlocks.MoveTo(&pendingIntegrationBlocks); }
+
+    void Integrate()
+    {
+        GetPageAllocator()->IntegrateSegments(pendingIntegrationSegments, pendingIntegrationSegmentCount, pendingIntegrationSegmentPageCount);
+        pendingIntegrationSegmentCount = 0;
+        pendingIntegrationSegmentPageCount = 0;
+
+#ifdef TRACK_ALLOC
+        TrackAllocData oldAllocData = recycler->nextAllocData;
+        recycler->nextAllocData.Clear();
+#endif
+        while (!pendingIntegrationBlocks.Empty())
+        {
+            TRACK_ALLOC_INFO(recycler, TObject, Recycler, 0, (size_t)-1);
+
+            BlockRecord& record = pendingIntegrationBlocks.Head();
+            if (!recycler->IntegrateBlock<attributes>(record.blockAddress, record.segment, GetAllocSize(), sizeof(TObject)))
+            {
+                Js::Throw::OutOfMemory();
+            }
+#if DBG && GLOBAL_ENABLE_WRITE_BARRIER
+            if (attributes != LeafBit && CONFIG_FLAG(ForceSoftwareWriteBarrier) && CONFIG_FLAG(RecyclerVerifyMark))
+            {
+                Recycler::WBSetBitRange(record.blockAddress, BlockSize / sizeof(void*));
+            }
+#endif
+            pendingIntegrationBlocks.RemoveHead(&NoThrowHeapAllocator::Instance);
+        }
+#ifdef TRACK_ALLOC
+        Assert(recycler->nextAllocData.IsEmpty());
+        recycler->nextAllocData = oldAllocData;
+#endif
+    }
+
+private:
+    // All allocations are small allocations
+    const size_t BlockSize = SmallAllocationBlockAttributes::PageCount * AutoSystemInfo::PageSize;
+
+    PageAllocator * GetPageAllocator() const
+    {
+        return attributes == LeafBit ?
+            this->recycler->GetDefaultHeapInfo()->GetRecyclerLeafPageAllocator() :
+            this->recycler->GetDefaultHeapInfo()->GetRecyclerPageAllocator();
+    }
+
+    size_t GetAllocSize() const
+    {
+#ifdef RECYCLER_MEMORY_VERIFY
+        if (recycler->VerifyEnabled())
+        {
+            return HeapInfo::GetAlignedSize(AllocSizeMath::Add(sizeof(TObject) + sizeof(size_t), recycler->GetVerifyPad()));
+        }
+#endif
+        return HeapInfo::GetAlignedSizeNoCheck(sizeof(TObject));
+    }
+
+    void AllocNewBlock()
+    {
+        Assert(nextObject + GetAllocSize() > currentBlockEnd);
+        if (hasCurrentBlock)
+        {
+            if (!filledBlocks.PrependNode(&NoThrowHeapAllocator::Instance, currentBlockEnd - BlockSize, currentSegment))
+            {
+                Js::Throw::OutOfMemory();
+            }
+            if (attributes != LeafBit)
+            {
+                // All integrated pages' objects are all live initially, so don't need to rescan them
+                // todo: SWB: need to allocate with write barrier pages
+                ::ResetWriteWatch(currentBlockEnd - BlockSize, BlockSize);
+            }
+            hasCurrentBlock = false;
+        }
+
+        if (currentBlockEnd == segmentEnd)
+        {
+            // Reserve the segment, but not committing it
+            currentSegment = PageAllocator::AllocPageSegment(pendingIntegrationSegments, GetPageAllocator(), false, true, false);
+            if (currentSegment == nullptr)
+            {
+                currentBlockEnd = nullptr;
+                segmentEnd = nullptr;
+                nextObject = nullptr;
+                Js::Throw::OutOfMemory();
+            }
+            pendingIntegrationSegmentCount++;
+            pendingIntegrationSegmentPageCount += currentSegment->GetPageCount();
+            currentBlockEnd = currentSegment->GetAddress();
+            segmentEnd = currentSegment->GetEndAddress();
+        }
+
+        // Commit the page.
+        if (!::VirtualAlloc(currentBlockEnd, BlockSize, MEM_COMMIT, PAGE_READWRITE))
+        {
+            Js::Throw::OutOfMemory();
+        }
+        nextObject = currentBlockEnd;
+        currentBlockEnd += BlockSize;
+        hasCurrentBlock = true;
+        this->recycler->GetDefaultHeapInfo()->GetRecyclerLeafPageAllocator()->FillAllocPages(nextObject, 1);
+    }
+
+    struct BlockRecord
+    {
+        BlockRecord(__in_ecount_pagesize char * blockAddress, PageSegment * segment)
+            : blockAddress(blockAddress), segment(segment)
+        {
+        }
+        char * blockAddress;
+        PageSegment * segment;
+    };
+
+    Recycler * recycler;
+    PageSegment * currentSegment;
+    char * segmentEnd;
+    char * currentBlockEnd;
+    char * nextObject;
+    bool hasCurrentBlock;
+
+    // Keep track of segments and pages that needs to be integrated to the recycler.
+    uint pendingIntegrationSegmentCount;
+    size_t pendingIntegrationSegmentPageCount;
+    DListBase<PageSegment> pendingIntegrationSegments;
+    SListBase<BlockRecord, NoThrowHeapAllocator> pendingIntegrationBlocks;
+    SListBase<BlockRecord, NoThrowHeapAllocator> sealedBlocks;
+    SListBase<BlockRecord, NoThrowHeapAllocator> filledBlocks;
+};
+}
@@ -81,6 +81,26 @@ LPVOID VirtualAllocWrapper::AllocPages(LPVOID lpAddress, size_t pageCount, DWORD
     return address;
 }
 
+// Only for data pages: the physical memory backing them is preferably taken from the given NUMA node
+LPVOID VirtualAllocWrapper::AllocPagesOnNumaNode(LPVOID lpAddress, size_t pageCount, DWORD allocationType, DWORD protectFlags, DWORD numaNode)
+{
+    Assert((protectFlags & (PAGE_EXECUTE | PAGE_EXECUTE_READ | PAGE_EXECUTE_READWRITE)) == 0);
+    if (pageCount > AutoSystemInfo::MaxPageCount)
+    {
+        return nullptr;
+    }
+    size_t dwSize = pageCount * AutoSystemInfo::PageSize;
+
+    LPVOID address = VirtualAllocExNuma(GetCurrentProcess(), lpAddress, dwSize, allocationType, protectFlags, numaNode);
+    if (address == nullptr)
+    {
+        MemoryOperationLastError::RecordLastError();
+        return nullptr;
+    }
+
+    return address;
+}
+
 BOOL VirtualAllocWrapper::Free(LPVOID lpAddress, size_t dwSize, DWORD dwFreeType)
 {
     AnalysisAssert(dwFreeType == MEM_RELEASE || dwFreeType == MEM_DECOMMIT);
@@ -252,12 +252,12 @@ typedef struct FldIDL
 typedef struct ArrayCallSiteIDL
 {
     byte bits;
+    byte headSegmentSizeHint;
 #if DBG
-    IDL_PAD1(0)
-    IDL_PAD2(1)
+    IDL_PAD2(0)
     unsigned int functionNumber;
     unsigned short callSiteNumber;
-    IDL_PAD2(2)
+    IDL_PAD2(1)
 #endif
 } ArrayCallSiteIDL;
 
@@ -1544,6 +1544,43 @@ CHAKRA_API
         _In_ JsHostPromiseRejectionTrackerCallback promiseRejectionTrackerCallback, 
         _In_opt_ void *callbackState);
 
+/// <summary>
+///     Makes the current context keep promise jobs in an engine-owned queue instead of handing
+///     each one to the callback set with <c>JsSetPromiseContinuationCallback</c>.
+/// </summary>
+/// <remarks>
+///     Requires an active script context.
+///     Once enabled, the host must run queued jobs with <c>JsDrainMicrotasks</c>. This avoids
+///     a host round trip for every job when promise-heavy code queues many of them.
+///     Not supported while time-travel debugging is recording or replaying.
+/// </remarks>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsEnableMicrotaskQueue();
+
+/// <summary>
+///     Runs promise jobs queued in the current context, in order, including jobs queued while
+///     draining.
+/// </summary>
+/// <remarks>
+///     Requires an active script context and a prior call to <c>JsEnableMicrotaskQueue</c>.
+///     If a job throws, draining stops and <c>JsErrorScriptException</c> is returned; the
+///     remaining jobs stay queued.
+/// </remarks>
+/// <param name="maxJobs">The maximum number of jobs to run, or 0 to run until the queue is empty.</param>
+/// <param name="jobsRun">The number of jobs that were run.</param>
+/// <param name="hasPendingJobs">Whether jobs are still queued when the call returns.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsDrainMicrotasks(
+        _In_ unsigned int maxJobs,
+        _Out_opt_ unsigned int *jobsRun,
+        _Out_ bool *hasPendingJobs);
+
 /// <summary>
 ///     Retrieve the namespace object for a module.
 /// </summary>
@@ -1731,6 +1768,207 @@ JsAllocRawData(
     _Out_ JsRef * buffer
 );
 
+/// <summary>
+///     Starts sampling the allocations made in the runtime, on average one every
+///     <paramref name="samplingInterval" /> bytes, and recording the script stack of each sample.
+/// </summary>
+/// <remarks>
+///     Sampled objects are tracked until they are collected, so the profile describes live memory.
+///     Starting the profiler again drops the samples taken so far. Allocations made directly by
+///     jitted code are not sampled.
+/// </remarks>
+/// <param name="runtimeHandle">The runtime to sample.</param>
+/// <param name="samplingInterval">The average number of bytes allocated between two samples.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStartSamplingHeapProfiler(
+        _In_ JsRuntimeHandle runtimeHandle,
+        _In_ size_t samplingInterval);
+
+/// <summary>
+///     Stops sampling allocations and drops the samples taken.
+/// </summary>
+/// <param name="runtimeHandle">The runtime being sampled.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStopSamplingHeapProfiler(
+        _In_ JsRuntimeHandle runtimeHandle);
+
+/// <summary>
+///     Gets the live sampled allocations of the current runtime, grouped by script stack.
+/// </summary>
+/// <remarks>
+///     Requires an active script context and a running sampling heap profiler.
+///     The profile is an object with a <c>samplingInterval</c> property and an <c>allocations</c>
+///     array. Each allocation has the estimated <c>size</c> in bytes and <c>count</c> of the live
+///     objects allocated at a <c>stack</c>, an array of frames with <c>functionName</c>,
+///     <c>url</c>, and the zero-based <c>line</c> and <c>column</c> of the function, innermost
+///     frame first. Allocations made with no script on the stack have an empty stack.
+/// </remarks>
+/// <param name="profile">The profile.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetSamplingHeapProfile(
+        _Out_ JsValueRef *profile);
+
+/// <summary>
+///     The kinds of record in a heap snapshot stream.
+/// </summary>
+/// <remarks>
+///     Each record is its kind in one byte followed by its fields, unpadded and in the byte order of
+///     the host. A name is a 32-bit count of UTF-16 code units followed by the code units; long names
+///     are truncated.
+/// </remarks>
+typedef enum _JsHeapSnapshotRecordKind
+{
+    /// <summary>
+    ///     A reachable object: its 64-bit id, its 64-bit size in bytes, its 32-bit <c>JsValueType</c>
+    ///     or -1 for memory internal to the engine, and its name. Functions are named after themselves
+    ///     and other objects after their constructor; the name is empty when it is not known.
+    /// </summary>
+    JsHeapSnapshotRecordNode = 0x1,
+    /// <summary>
+    ///     A reference: the 64-bit ids of the referencing and the referenced objects, and the 32-bit
+    ///     id of the property holding the reference, or -1 for a reference held in an internal slot.
+    /// </summary>
+    JsHeapSnapshotRecordEdge = 0x2,
+    /// <summary>
+    ///     A property name: its 32-bit id and the name. It comes before the first edge using the id.
+    /// </summary>
+    JsHeapSnapshotRecordPropertyName = 0x3
+} JsHeapSnapshotRecordKind;
+
+/// <summary>
+///     A callback called with each chunk of a heap snapshot stream.
+/// </summary>
+/// <remarks>
+///     A chunk only holds whole records and is only valid during the callback. The callback must not
+///     call back into the runtime.
+/// </remarks>
+/// <param name="chunk">The records.</param>
+/// <param name="length">The length of the chunk in bytes.</param>
+/// <param name="callbackState">The state passed to <c>JsStreamHeapSnapshot</c>.</param>
+/// <returns>
+///     true to continue the snapshot, false to stop it.
+/// </returns>
+typedef bool (CHAKRA_CALLBACK *JsHeapSnapshotChunkCallback)(_In_reads_bytes_(length) const BYTE *chunk, _In_ size_t length, _In_opt_ void *callbackState);
+
+/// <summary>
+///     Streams the objects reachable in a runtime and the references between them.
+/// </summary>
+/// <remarks>
+///     <para>
+///     The heap is marked without being collected, so objects waiting to be collected are left out.
+///     Objects are identified by their address, which is only meaningful within one snapshot. Edges
+///     may refer to objects whose node comes later in the stream.
+///     </para>
+///     <para>
+///     References in internal slots are found by scanning the object for pointers to the start of
+///     other objects, the same way the collector does. Properties of script objects are reported as
+///     well, under their property name.
+///     </para>
+///     <para>
+///     The snapshot is written to a fixed-size buffer that is passed to the callback whenever it fills,
+///     so its memory use does not grow with the size of the heap. The runtime cannot allocate or
+///     collect while the snapshot is taken.
+///     </para>
+/// </remarks>
+/// <param name="runtimeHandle">The runtime to take the snapshot of.</param>
+/// <param name="callback">The callback the snapshot is streamed to.</param>
+/// <param name="callbackState">User provided state that will be passed back to the callback.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded or was stopped by the callback, a failure
+///     code otherwise.
+/// </returns>
+CHAKRA_API
+    JsStreamHeapSnapshot(
+        _In_ JsRuntimeHandle runtimeHandle,
+        _In_ JsHeapSnapshotChunkCallback callback,
+        _In_opt_ void *callbackState);
+
+/// <summary>
+///     Statistics of the JIT queue for one tier of jitted code.
+/// </summary>
+typedef struct _JsJitQueueTierStats
+{
+    /// <summary>The number of functions and loop bodies queued for the tier.</summary>
+    unsigned int queuedCount;
+    /// <summary>The number of functions and loop bodies compiled for the tier.</summary>
+    unsigned int compiledCount;
+    /// <summary>The total time the compiled functions and loop bodies waited in the queue, in microseconds.</summary>
+    unsigned long long totalWaitTimeMicroseconds;
+    /// <summary>The total time spent compiling them, in microseconds.</summary>
+    unsigned long long totalCompileTimeMicroseconds;
+} JsJitQueueTierStats;
+
+/// <summary>
+///     Statistics of the JIT queues of a runtime.
+/// </summary>
+typedef struct _JsJitQueueStats
+{
+    /// <summary>The simple JIT tier.</summary>
+    JsJitQueueTierStats simpleJit;
+    /// <summary>The full JIT tier.</summary>
+    JsJitQueueTierStats fullJit;
+    /// <summary>The deepest the full JIT queue of a script context has been.</summary>
+    unsigned int maxFullJitQueueDepth;
+    /// <summary>
+    ///     The number of full JIT functions and loop bodies dropped from a queue that reached its threshold.
+    /// </summary>
+    unsigned int droppedCount;
+} JsJitQueueStats;
+
+/// <summary>
+///     Gets the statistics of the JIT queues of a runtime since it was created.
+/// </summary>
+/// <remarks>
+///     The statistics can be retrieved regardless of whether or not the runtime is active on another
+///     thread, in which case they may be slightly out of date. They are all zero when the runtime does
+///     not jit code. The wait and compile times only cover functions and loop bodies queued after the
+///     first call, so a host interested in them should call it once when the runtime is created.
+/// </remarks>
+/// <param name="runtimeHandle">The runtime whose statistics are to be retrieved.</param>
+/// <param name="stats">The statistics.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsGetRuntimeJitQueueStats(
+        _In_ JsRuntimeHandle runtimeHandle,
+        _Out_ JsJitQueueStats *stats);
+
+/// <summary>
+///     Places a runtime on a NUMA node.
+/// </summary>
+/// <remarks>
+///     <para>
+///     Memory the runtime reserves from now on prefers the node for its physical pages, and the
+///     garbage collection and background JIT threads of the runtime are pinned to the processors of
+///     the node before they next do work. Memory already allocated stays where it is, so this is best
+///     called right after the runtime is created.
+///     </para>
+///     <para>
+///     The node is a preference: pages come from other nodes once the node runs out of memory.
+///     Threads of a thread service passed to <c>JsCreateRuntime</c> are left where the host put them.
+///     Only the first 64 processors of the machine can be pinned to.
+///     </para>
+/// </remarks>
+/// <param name="runtimeHandle">The runtime to place.</param>
+/// <param name="numaNode">The node, or -1 to lift the placement.</param>
+/// <returns>
+///     The code <c>JsNoError</c> if the operation succeeded, a failure code otherwise.
+/// </returns>
+CHAKRA_API
+    JsSetRuntimeNumaNode(
+        _In_ JsRuntimeHandle runtimeHandle,
+        _In_ int numaNode);
+
 /// <summary>
 ///     A callback function to ask host to re-allocated buffer to the new size when the current buffer is full
 /// </summary>
@@ -7,6 +7,7 @@
 #include "JsrtInternal.h"
 #include "JsrtExternalObject.h"
 #include "JsrtExternalArrayBuffer.h"
+#include "JsrtHeapSnapshot.h"
 #include "jsrtHelper.h"
 #include "SCACorePch.h"
 #include "JsrtContextCore.h"
@@ -1241,6 +1242,70 @@ CHAKRA_API JsSetHostPromiseRejectionTracker(_In_ JsHostPromiseRejectionTrackerCa
         /*allowInObjectBeforeCollectCallback*/true);
 }
 
+CHAKRA_API JsEnableMicrotaskQueue()
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+#if ENABLE_TTD
+        if (scriptContext->IsTTDRecordOrReplayModeEnabled())
+        {
+            // Record/replay logs each job through the host continuation callback.
+            return JsErrorNotImplemented;
+        }
+#endif
+
+        scriptContext->GetLibrary()->EnableMicrotaskQueue();
+        return JsNoError;
+    },
+        /*allowInObjectBeforeCollectCallback*/true);
+}
+
+CHAKRA_API JsDrainMicrotasks(_In_ unsigned int maxJobs, _Out_opt_ unsigned int *jobsRun, _Out_ bool *hasPendingJobs)
+{
+    PARAM_NOT_NULL(hasPendingJobs);
+    *hasPendingJobs = false;
+
+    if (jobsRun != nullptr)
+    {
+        *jobsRun = 0;
+    }
+
+    Js::JavascriptLibrary *library = nullptr;
+    unsigned int count = 0;
+
+    JsErrorCode errorCode = ContextAPIWrapper<JSRT_MAYBE_TRUE>([&](Js::ScriptContext *scriptContext, TTDRecorder& _actionEntryPopper) -> JsErrorCode {
+        library = scriptContext->GetLibrary();
+        if (!library->IsMicrotaskQueueEnabled())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        // Run the jobs back to back from a single script entry. Jobs queued by the jobs
+        // themselves are picked up by the same loop.
+        Js::Var thisArg = library->GetUndefined();
+        while (library->HasPendingMicrotasks() && (maxJobs == 0 || count < maxJobs))
+        {
+            Js::JavascriptFunction *task = Js::VarTo<Js::JavascriptFunction>(library->DequeueMicrotask());
+            Js::Arguments args(Js::CallInfo(1), &thisArg);
+            count++;
+            task->CallRootFunction(args, scriptContext, true);
+        }
+
+        return JsNoError;
+    });
+
+    if (jobsRun != nullptr)
+    {
+        *jobsRun = count;
+    }
+
+    if (library != nullptr)
+    {
+        *hasPendingJobs = library->HasPendingMicrotasks();
+    }
+
+    return errorCode;
+}
+
 CHAKRA_API JsGetProxyProperties(_In_ JsValueRef object, _Out_ bool* isProxy, _Out_opt_ JsValueRef* target, _Out_opt_ JsValueRef* handler)
 {
     return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext * scriptContext) -> JsErrorCode {
@@ -1459,6 +1524,153 @@ CHAKRA_API JsAllocRawData(_In_ JsRuntimeHandle runtimeHandle, _In_ size_t sizeIn
     });
 }
 
+CHAKRA_API JsStartSamplingHeapProfiler(_In_ JsRuntimeHandle runtimeHandle, _In_ size_t samplingInterval)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        if (samplingInterval == 0)
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->StartSamplingHeapProfiler(samplingInterval);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStopSamplingHeapProfiler(_In_ JsRuntimeHandle runtimeHandle)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->StopSamplingHeapProfiler();
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetSamplingHeapProfile(_Out_ JsValueRef *profile)
+{
+    return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
+        PARAM_NOT_NULL(profile);
+        *profile = JS_INVALID_REFERENCE;
+
+        ThreadContext * threadContext = scriptContext->GetThreadContext();
+        if (!threadContext->IsSamplingHeapProfilerRunning())
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        *profile = threadContext->GetSamplingHeapProfile(scriptContext);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsStreamHeapSnapshot(_In_ JsRuntimeHandle runtimeHandle, _In_ JsHeapSnapshotChunkCallback callback, _In_opt_ void *callbackState)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+        PARAM_NOT_NULL(callback);
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+
+        if (threadContext->GetRecycler() && threadContext->GetRecycler()->IsHeapEnumInProgress())
+        {
+            return JsErrorHeapEnumInProgress;
+        }
+        else if (threadContext->IsInThreadServiceCallback())
+        {
+            return JsErrorInThreadServiceCallback;
+        }
+
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->EnsureRecycler();
+
+        JsrtHeapSnapshot snapshot(threadContext, callback, callbackState);
+        if (!snapshot.Stream())
+        {
+            return JsErrorRuntimeInUse;
+        }
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsSetRuntimeNumaNode(_In_ JsRuntimeHandle runtimeHandle, _In_ int numaNode)
+{
+    return GlobalAPIWrapper_NoRecord([&]() -> JsErrorCode {
+        VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+
+        if (numaNode < -1 || (numaNode != -1 && (ULONG)numaNode > AutoSystemInfo::Data.GetHighestNumaNodeNumber()))
+        {
+            return JsErrorInvalidArgument;
+        }
+
+        ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+        ThreadContextScope scope(threadContext);
+
+        if (!scope.IsValid())
+        {
+            return JsErrorWrongThread;
+        }
+
+        threadContext->SetNumaNode(numaNode == -1 ? NUMA_NO_PREFERRED_NODE : (DWORD)numaNode);
+        return JsNoError;
+    });
+}
+
+CHAKRA_API JsGetRuntimeJitQueueStats(_In_ JsRuntimeHandle runtimeHandle, _Out_ JsJitQueueStats *stats)
+{
+    VALIDATE_INCOMING_RUNTIME_HANDLE(runtimeHandle);
+    PARAM_NOT_NULL(stats);
+    memset(stats, 0, sizeof(*stats));
+
+#if ENABLE_NATIVE_CODEGEN
+    ThreadContext * threadContext = JsrtRuntime::FromHandle(runtimeHandle)->GetThreadContext();
+    JitQueueStats * jitQueueStats = threadContext->GetJitQueueStats();
+    jitQueueStats->EnableTiming();
+
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+
+    JsJitQueueTierStats *const tierStats[] = { &stats->simpleJit, &stats->fullJit };
+    CompileAssert(_countof(tierStats) == JitQueueStats::TierCount);
+    for (uint i = 0; i < JitQueueStats::TierCount; i++)
+    {
+        const JitQueueStats::TierStats &tier = jitQueueStats->GetTierStats((JitQueueStats::Tier)i);
+        tierStats[i]->queuedCount = (unsigned int)tier.queuedCount;
+        tierStats[i]->compiledCount = (unsigned int)tier.compiledCount;
+        tierStats[i]->totalWaitTimeMicroseconds = (unsigned long long)((double)tier.waitTicks * 1000000.0 / (double)freq.QuadPart);
+        tierStats[i]->totalCompileTimeMicroseconds = (unsigned long long)((double)tier.compileTicks * 1000000.0 / (double)freq.QuadPart);
+    }
+    stats->maxFullJitQueueDepth = (unsigned int)jitQueueStats->GetMaxFullJitQueueDepth();
+    stats->droppedCount = (unsigned int)jitQueueStats->GetDroppedCount();
+#endif
+
+    return JsNoError;
+}
+
 CHAKRA_API JsIsCallable(_In_ JsValueRef object, _Out_ bool *isCallable)
 {
     return ContextAPINoScriptWrapper_NoRecord([&](Js::ScriptContext *scriptContext) -> JsErrorCode {
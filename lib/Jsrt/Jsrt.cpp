@@ -1037,6 +1037,50 @@ CHAKRA_API JsConvertValueToBoolean(_In_ JsValueRef value, _Out_ JsValueRef *resu
     });
 }
 
+JsValueType GetJsValueType(Js::TypeId typeId)
+{
+    switch (typeId)
+    {
+    case Js::TypeIds_Undefined:
+        return JsUndefined;
+    case Js::TypeIds_Null:
+        return JsNull;
+    case Js::TypeIds_Boolean:
+        return JsBoolean;
+    case Js::TypeIds_Integer:
+    case Js::TypeIds_Number:
+    case Js::TypeIds_Int64Number:
+    case Js::TypeIds_UInt64Number:
+        return JsNumber;
+    case Js::TypeIds_String:
+        return JsString;
+    case Js::TypeIds_Function:
+        return JsFunction;
+    case Js::TypeIds_Error:
+        return JsError;
+    case Js::TypeIds_Array:
+    case Js::TypeIds_NativeIntArray:
+#if ENABLE_COPYONACCESS_ARRAY
+    case Js::TypeIds_CopyOnAccessNativeIntArray:
+#endif
+    case Js::TypeIds_NativeFloatArray:
+    case Js::TypeIds_ES5Array:
+        return JsArray;
+    case Js::TypeIds_Symbol:
+        return JsSymbol;
+    case Js::TypeIds_ArrayBuffer:
+        return JsArrayBuffer;
+    case Js::TypeIds_DataView:
+        return JsDataView;
+    default:
+        if (Js::TypedArrayBase::Is(typeId))
+        {
+            return JsTypedArray;
+        }
+        return JsObject;
+    }
+}
+
 CHAKRA_API JsGetValueType(_In_ JsValueRef value, _Out_ JsValueType *type)
 {
     VALIDATE_JSREF(value);
@@ -1044,62 +1088,7 @@ CHAKRA_API JsGetValueType(_In_ JsValueRef value, _Out_ JsValueType *type)
 
     BEGIN_JSRT_NO_EXCEPTION
     {
-        Js::TypeId typeId = Js::JavascriptOperators::GetTypeId(value);
-        switch (typeId)
-        {
-        case Js::TypeIds_Undefined:
-            *type = JsUndefined;
-            break;
-        case Js::TypeIds_Null:
-            *type = JsNull;
-            break;
-        case Js::TypeIds_Boolean:
-            *type = JsBoolean;
-            break;
-        case Js::TypeIds_Integer:
-        case Js::TypeIds_Number:
-        case Js::TypeIds_Int64Number:
-        case Js::TypeIds_UInt64Number:
-            *type = JsNumber;
-            break;
-        case Js::TypeIds_String:
-            *type = JsString;
-            break;
-        case Js::TypeIds_Function:
-            *type = JsFunction;
-            break;
-        case Js::TypeIds_Error:
-            *type = JsError;
-            break;
-        case Js::TypeIds_Array:
-        case Js::TypeIds_NativeIntArray:
-#if ENABLE_COPYONACCESS_ARRAY
-        case Js::TypeIds_CopyOnAccessNativeIntArray:
-#endif
-        case Js::TypeIds_NativeFloatArray:
-        case Js::TypeIds_ES5Array:
-            *type = JsArray;
-            break;
-        case Js::TypeIds_Symbol:
-            *type = JsSymbol;
-            break;
-        case Js::TypeIds_ArrayBuffer:
-            *type = JsArrayBuffer;
-            break;
-        case Js::TypeIds_DataView:
-            *type = JsDataView;
-            break;
-        default:
-            if (Js::TypedArrayBase::Is(typeId))
-            {
-                *type = JsTypedArray;
-            }
-            else
-            {
-                *type = JsObject;
-            }
-            break;
-        }
+        *type = GetJsValueType(Js::JavascriptOperators::GetTypeId(value));
     }
     END_JSRT_NO_EXCEPTION
 }
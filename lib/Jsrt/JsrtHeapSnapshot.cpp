@@ -0,0 +1,412 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "JsrtPch.h"
+#include "JsrtInternal.h"
+#include "JsrtHeapSnapshot.h"
+#include "JsrtExternalObject.h"
+#include "Library/ES5Array.h"
+#include "Library/SameValueComparer.h"
+#include "Library/MapOrSetDataList.h"
+#include "Library/JavascriptMap.h"
+#include "Library/JavascriptSet.h"
+#include "Library/JavascriptPromise.h"
+
+JsrtHeapSnapshot::JsrtHeapSnapshot(ThreadContext * threadContext, JsHeapSnapshotChunkCallback callback, void * callbackState) :
+    threadContext(threadContext),
+    recycler(threadContext->GetRecycler()),
+    callback(callback),
+    callbackState(callbackState),
+    buffer(nullptr),
+    bufferUsed(0),
+    stopped(false),
+    libraries(&HeapAllocator::Instance),
+    knownVtables(&HeapAllocator::Instance),
+    writtenPropertyNames(&HeapAllocator::Instance)
+{
+}
+
+JsrtHeapSnapshot::~JsrtHeapSnapshot()
+{
+    if (this->buffer != nullptr)
+    {
+        HeapDeleteArray(BufferSize, this->buffer);
+    }
+}
+
+bool
+JsrtHeapSnapshot::Stream()
+{
+    // Everything allocated while the heap is enumerated must come from the heap allocator, so allocate what
+    // is known up front now.
+    this->buffer = HeapNewArray(BYTE, BufferSize);
+
+    for (Js::ScriptContext * scriptContext = this->threadContext->GetScriptContextList();
+        scriptContext != nullptr;
+        scriptContext = scriptContext->next)
+    {
+        if (!scriptContext->IsClosed())
+        {
+            this->libraries.Add(scriptContext->GetLibrary());
+        }
+    }
+
+    this->AddKnownVtables();
+
+    if (!this->recycler->EnumerateLiveObjects(&JsrtHeapSnapshot::EnumerateObjectCallback, this))
+    {
+        return false;
+    }
+
+    this->Flush();
+    return true;
+}
+
+void
+JsrtHeapSnapshot::EnumerateObjectCallback(void * callbackState, void * address, size_t size, ObjectInfoBits attributes)
+{
+    JsrtHeapSnapshot * snapshot = (JsrtHeapSnapshot *)callbackState;
+    if (snapshot->stopped)
+    {
+        return;
+    }
+
+    try
+    {
+        snapshot->WriteObject(address, size, attributes);
+    }
+    catch (Js::OutOfMemoryException)
+    {
+        // Exceptions can't unwind through the heap enumeration; end the stream at the last whole record
+        snapshot->Flush();
+        snapshot->stopped = true;
+    }
+}
+
+void
+JsrtHeapSnapshot::WriteObject(void * address, size_t size, ObjectInfoBits attributes)
+{
+    Js::RecyclableObject * object = this->GetRecyclableObject(address, size);
+    if (object == nullptr)
+    {
+        this->WriteNode(address, size, InternalNodeType, nullptr);
+    }
+    else
+    {
+        this->WriteNode(address, size, GetJsValueType(object->GetTypeId()), this->GetName(object, size));
+
+        if (Js::DynamicType::Is(object->GetTypeId()))
+        {
+            this->WritePropertyEdges((Js::DynamicObject *)object, size);
+        }
+    }
+
+    if ((attributes & LeafBit) == 0)
+    {
+        this->WriteInternalEdges(address, size);
+    }
+}
+
+void
+JsrtHeapSnapshot::WritePropertyEdges(Js::DynamicObject * object, size_t size)
+{
+    Js::DynamicTypeHandler * typeHandler = object->GetTypeHandler();
+    if (typeHandler->IsDeferredTypeHandler())
+    {
+        // Looking up properties would initialize the object
+        return;
+    }
+
+    Js::ScriptContext * scriptContext = object->GetScriptContext();
+    const int propertyCount = typeHandler->GetPropertyCount();
+    for (int i = 0; i < propertyCount && !this->stopped; i++)
+    {
+        const Js::PropertyId propertyId = typeHandler->GetPropertyId(scriptContext, (Js::BigPropertyIndex)i);
+        if (propertyId == Js::Constants::NoProperty)
+        {
+            continue;
+        }
+
+        // Accessors have no slot; their getter and setter are found by the internal edges
+        const Js::PropertyIndex slot = typeHandler->GetPropertyIndex(scriptContext->GetPropertyName(propertyId));
+        if (slot == Js::Constants::NoSlot)
+        {
+            continue;
+        }
+
+        Js::Var value;
+        if (this->TryGetSlot(object, size, slot, &value) && this->IsReachableObject(value))
+        {
+            this->WritePropertyName(scriptContext, propertyId);
+            this->WriteEdge(object, value, (uint32)propertyId);
+        }
+    }
+}
+
+void
+JsrtHeapSnapshot::WriteInternalEdges(void * address, size_t size)
+{
+    // Find references the way the recycler does, so that every object the mark reached through this one is
+    // reported even when the layout of the object is unknown.
+    void ** slots = (void **)address;
+    const size_t slotCount = size / sizeof(void *);
+    for (size_t i = 0; i < slotCount && !this->stopped; i++)
+    {
+        void * candidate = slots[i];
+        if (candidate != address && this->IsReachableObject(candidate))
+        {
+            this->WriteEdge(address, candidate, InternalEdgeName);
+        }
+    }
+}
+
+void
+JsrtHeapSnapshot::AddKnownVtables()
+{
+    // Nothing records what an allocation holds, so an allocation is only taken to be a script object if it
+    // starts with the vtable of one of these classes. Objects of other classes are reported as internal nodes;
+    // their references are still found by WriteInternalEdges.
+    if (this->libraries.Count() != 0)
+    {
+        // The vtables the JIT checks against are the same in every library
+        const INT_PTR * vtableAddresses = this->libraries.Item(0)->GetVTableAddresses();
+        for (uint i = 0; i < VTableValue::Count; i++)
+        {
+            if (i != VTableValue::VtableInvalid && vtableAddresses[i] != 0)
+            {
+                this->knownVtables.AddNew(vtableAddresses[i]);
+            }
+        }
+    }
+
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptFunction>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::RuntimeFunction>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptExternalFunction>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::BoundFunction>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::ScriptFunctionWithInlineCache>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::GlobalObject>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::ES5Array>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptError>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptSymbol>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptMap>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptSet>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptPromise>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptProxy>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::JavascriptArrayBuffer>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<Js::LiteralString>::Address);
+    this->knownVtables.AddNew(VirtualTableInfo<JsrtExternalObject>::Address);
+}
+
+Js::RecyclableObject *
+JsrtHeapSnapshot::GetRecyclableObject(void * address, size_t size)
+{
+    if (size < sizeof(Js::RecyclableObject) || !this->knownVtables.Contains(VirtualTableInfoBase::GetVirtualTable(address)))
+    {
+        return nullptr;
+    }
+
+    // Objects of a closed script context may still be alive, but their library can no longer be trusted
+    Js::RecyclableObject * object = (Js::RecyclableObject *)address;
+    Js::Type * type = object->GetType();
+    if (type == nullptr || (uint)type->GetTypeId() >= Js::TypeIds_Limit || !this->libraries.Contains(type->GetLibrary()))
+    {
+        return nullptr;
+    }
+
+    return object;
+}
+
+Js::RecyclableObject *
+JsrtHeapSnapshot::FindRecyclableObject(Js::Var value, size_t * size)
+{
+    // Objects found through another object need their allocation size looked up before they are read
+    RecyclerHeapObjectInfo heapObject;
+    if (!this->IsReachableObject(value) || !this->recycler->FindHeapObject(value, FindHeapObjectFlags_NoFreeBitVerify, heapObject))
+    {
+        return nullptr;
+    }
+
+    *size = heapObject.GetSize();
+    return this->GetRecyclableObject(value, *size);
+}
+
+bool
+JsrtHeapSnapshot::TryGetSlot(Js::DynamicObject * object, size_t size, Js::PropertyIndex slot, Js::Var * value)
+{
+    // A type handler that does not match the object must not make us read past the allocation
+    Js::DynamicTypeHandler * typeHandler = object->GetTypeHandler();
+    if (slot >= typeHandler->GetSlotCapacity())
+    {
+        return false;
+    }
+
+    if (slot < typeHandler->GetInlineSlotCapacity())
+    {
+        const size_t offset = typeHandler->GetOffsetOfInlineSlots() + slot * sizeof(Js::Var);
+        if (offset + sizeof(Js::Var) > size)
+        {
+            return false;
+        }
+
+        *value = *(Js::Var *)((BYTE *)object + offset);
+        return true;
+    }
+
+    const size_t auxSlotsOffset = Js::DynamicObject::GetOffsetOfAuxSlots();
+    if (auxSlotsOffset + sizeof(Js::Var *) > size)
+    {
+        return false;
+    }
+
+    Js::Var * auxSlots = *(Js::Var **)((BYTE *)object + auxSlotsOffset);
+    const size_t auxSlot = slot - typeHandler->GetInlineSlotCapacity();
+    if (!this->recycler->IsValidObject(auxSlots, (auxSlot + 1) * sizeof(Js::Var)))
+    {
+        return false;
+    }
+
+    *value = auxSlots[auxSlot];
+    return true;
+}
+
+const char16 *
+JsrtHeapSnapshot::GetName(Js::RecyclableObject * object, size_t size)
+{
+    if (object->GetTypeId() == Js::TypeIds_Function)
+    {
+        return this->GetFunctionName(object, size);
+    }
+
+    // Name other objects after their constructor, looking it up through the type handler of the prototype
+    // so that no getter is run.
+    size_t prototypeSize;
+    Js::RecyclableObject * prototype = this->FindRecyclableObject(object->GetPrototype(), &prototypeSize);
+    if (prototype == nullptr || !Js::DynamicType::Is(prototype->GetTypeId()))
+    {
+        return nullptr;
+    }
+
+    Js::DynamicObject * dynamicPrototype = (Js::DynamicObject *)prototype;
+    Js::DynamicTypeHandler * typeHandler = dynamicPrototype->GetTypeHandler();
+    if (typeHandler->IsDeferredTypeHandler())
+    {
+        return nullptr;
+    }
+
+    Js::ScriptContext * scriptContext = prototype->GetScriptContext();
+    const Js::PropertyIndex slot = typeHandler->GetPropertyIndex(scriptContext->GetPropertyName(Js::PropertyIds::constructor));
+    Js::Var constructor;
+    if (slot == Js::Constants::NoSlot || !this->TryGetSlot(dynamicPrototype, prototypeSize, slot, &constructor))
+    {
+        return nullptr;
+    }
+
+    size_t constructorSize;
+    Js::RecyclableObject * constructorObject = this->FindRecyclableObject(constructor, &constructorSize);
+    if (constructorObject == nullptr)
+    {
+        return nullptr;
+    }
+
+    return this->GetFunctionName(constructorObject, constructorSize);
+}
+
+const char16 *
+JsrtHeapSnapshot::GetFunctionName(Js::RecyclableObject * function, size_t size)
+{
+    if (size < sizeof(Js::JavascriptFunction) || !Js::VarIs<Js::JavascriptFunction>(function))
+    {
+        return nullptr;
+    }
+
+    // Built-in functions have no function body to take the name from, and getting their name property
+    // would allocate.
+    Js::FunctionProxy * proxy = Js::VarTo<Js::JavascriptFunction>(function)->GetFunctionProxy();
+    if (proxy == nullptr || proxy->IsDeferredDeserializeFunction())
+    {
+        return nullptr;
+    }
+
+    return proxy->GetParseableFunctionInfo()->GetExternalDisplayName();
+}
+
+bool
+JsrtHeapSnapshot::IsReachableObject(void * candidate)
+{
+    return this->recycler->IsValidObject(candidate) && this->recycler->IsObjectMarked(candidate);
+}
+
+void
+JsrtHeapSnapshot::WriteNode(void * address, size_t size, int32 type, const char16 * name)
+{
+    const size_t nameLength = name == nullptr ? 0 : min(wcslen(name), (size_t)MaxNameLength);
+    this->Reserve(sizeof(BYTE) + sizeof(uint64) + sizeof(uint64) + sizeof(int32) + sizeof(uint32) + nameLength * sizeof(char16));
+    this->Write<BYTE>(JsHeapSnapshotRecordNode);
+    this->Write<uint64>((uint64)address);
+    this->Write<uint64>((uint64)size);
+    this->Write<int32>(type);
+    this->WriteName(name, nameLength);
+}
+
+void
+JsrtHeapSnapshot::WriteEdge(void * from, void * to, uint32 name)
+{
+    this->Reserve(sizeof(BYTE) + sizeof(uint64) + sizeof(uint64) + sizeof(uint32));
+    this->Write<BYTE>(JsHeapSnapshotRecordEdge);
+    this->Write<uint64>((uint64)from);
+    this->Write<uint64>((uint64)to);
+    this->Write<uint32>(name);
+}
+
+void
+JsrtHeapSnapshot::WritePropertyName(Js::ScriptContext * scriptContext, Js::PropertyId propertyId)
+{
+    if (this->writtenPropertyNames.TestAndSet(propertyId))
+    {
+        return;
+    }
+
+    Js::PropertyRecord const * propertyRecord = scriptContext->GetPropertyName(propertyId);
+    const size_t nameLength = min((size_t)propertyRecord->GetLength(), (size_t)MaxNameLength);
+    this->Reserve(sizeof(BYTE) + sizeof(uint32) + sizeof(uint32) + nameLength * sizeof(char16));
+    this->Write<BYTE>(JsHeapSnapshotRecordPropertyName);
+    this->Write<uint32>((uint32)propertyId);
+    this->WriteName(propertyRecord->GetBuffer(), nameLength);
+}
+
+void
+JsrtHeapSnapshot::WriteName(const char16 * name, size_t length)
+{
+    Assert(length <= MaxNameLength);
+    this->Write<uint32>((uint32)length);
+    if (length != 0)
+    {
+        js_memcpy_s(this->buffer + this->bufferUsed, BufferSize - this->bufferUsed, name, length * sizeof(char16));
+        this->bufferUsed += length * sizeof(char16);
+    }
+}
+
+void
+JsrtHeapSnapshot::Reserve(size_t length)
+{
+    Assert(length <= BufferSize);
+    if (this->bufferUsed + length > BufferSize)
+    {
+        this->Flush();
+    }
+}
+
+void
+JsrtHeapSnapshot::Flush()
+{
+    // Once stopped, whatever is still written for the current object is dropped
+    if (this->bufferUsed != 0 && !this->stopped)
+    {
+        if (!this->callback(this->buffer, this->bufferUsed, this->callbackState))
+        {
+            this->stopped = true;
+        }
+    }
+    this->bufferUsed = 0;
+}
@@ -0,0 +1,66 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+#include "ChakraCore.h"
+
+// Streams the objects reachable in a thread context to a host callback as JsHeapSnapshotRecordKind records.
+// The records are written to a fixed-size buffer handed to the host whenever it fills up; apart from that the
+// only state is the set of script contexts, the vtables of the classes reported as script objects and a bit per
+// property name already written, so the memory used does not depend on the size of the heap.
+class JsrtHeapSnapshot
+{
+public:
+    JsrtHeapSnapshot(ThreadContext * threadContext, JsHeapSnapshotChunkCallback callback, void * callbackState);
+    ~JsrtHeapSnapshot();
+
+    // Returns false if the heap could not be enumerated
+    bool Stream();
+
+private:
+    static const size_t BufferSize = 64 * 1024;
+    static const uint MaxNameLength = 1024;
+    static const int32 InternalNodeType = -1;
+    static const uint32 InternalEdgeName = (uint32)-1;
+
+    static void EnumerateObjectCallback(void * callbackState, void * address, size_t size, ObjectInfoBits attributes);
+    void WriteObject(void * address, size_t size, ObjectInfoBits attributes);
+    void WritePropertyEdges(Js::DynamicObject * object, size_t size);
+    void WriteInternalEdges(void * address, size_t size);
+
+    void AddKnownVtables();
+    Js::RecyclableObject * GetRecyclableObject(void * address, size_t size);
+    Js::RecyclableObject * FindRecyclableObject(Js::Var value, size_t * size);
+    bool TryGetSlot(Js::DynamicObject * object, size_t size, Js::PropertyIndex slot, Js::Var * value);
+    const char16 * GetName(Js::RecyclableObject * object, size_t size);
+    const char16 * GetFunctionName(Js::RecyclableObject * function, size_t size);
+    bool IsReachableObject(void * candidate);
+
+    void WriteNode(void * address, size_t size, int32 type, const char16 * name);
+    void WriteEdge(void * from, void * to, uint32 name);
+    void WritePropertyName(Js::ScriptContext * scriptContext, Js::PropertyId propertyId);
+    void WriteName(const char16 * name, size_t length);
+    void Reserve(size_t length);
+    void Flush();
+
+    template <typename T>
+    void Write(T value)
+    {
+        Assert(this->bufferUsed + sizeof(T) <= BufferSize);
+        js_memcpy_s(this->buffer + this->bufferUsed, BufferSize - this->bufferUsed, &value, sizeof(T));
+        this->bufferUsed += sizeof(T);
+    }
+
+    ThreadContext * threadContext;
+    Recycler * recycler;
+    JsHeapSnapshotChunkCallback callback;
+    void * callbackState;
+    BYTE * buffer;
+    size_t bufferUsed;
+    bool stopped;
+    JsUtil::List<Js::JavascriptLibrary *, HeapAllocator> libraries;
+    JsUtil::BaseHashSet<INT_PTR, HeapAllocator> knownVtables;
+    BVSparse<HeapAllocator> writtenPropertyNames;
+};
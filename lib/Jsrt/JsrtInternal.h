@@ -399,6 +399,8 @@ JsErrorCode SetContextAPIWrapper(JsrtContext* newContext, Fn fn)
 
 void HandleScriptCompileError(Js::ScriptContext * scriptContext, CompileScriptException * se, const WCHAR * sourceUrl = nullptr);
 
+JsValueType GetJsValueType(Js::TypeId typeId);
+
 #if DBG
 #define _PREPARE_RETURN_NO_EXCEPTION __debugCheckNoException.hasException = false;
 #else
@@ -1439,6 +1439,57 @@ tokens Scanner<EncodingPolicy>::ScanStringConstant(OLECHAR delim, EncodedCharPtr
     return ScanStringConstant<false, false>(delim, pp);
 }
 
+/*****************************************************************************
+*
+*  Skip the run of ASCII code units in a comment body that need no handling:
+*  anything other than line terminators, NUL and (in a block comment) '*'.
+*  Returns a pointer to the first unit that has to go through the regular
+*  per-character dispatch.
+*/
+template<typename EncodingPolicy>
+template<bool stopAtStar>
+typename Scanner<EncodingPolicy>::EncodedCharPtr Scanner<EncodingPolicy>::SkipCommentRun(EncodedCharPtr p, EncodedCharPtr last)
+{
+    if (sizeof(EncodedChar) == 1)
+    {
+        // Test eight code units at a time. (x - 0x01..01) & ~x & 0x80..80 is non-zero exactly
+        // when some byte of x is zero, so xor-ing with a broadcast character tests for that character.
+        const uint64 ones = 0x0101010101010101ull;
+        const uint64 highBits = 0x8080808080808080ull;
+        while (last - p >= (ptrdiff_t)sizeof(uint64))
+        {
+            uint64 word;
+            memcpy(&word, p, sizeof(word));
+
+            const uint64 nwl = word ^ (ones * kchNWL);
+            const uint64 ret = word ^ (ones * kchRET);
+            uint64 stop = word | ((word - ones) & ~word) | ((nwl - ones) & ~nwl) | ((ret - ones) & ~ret);
+            if (stopAtStar)
+            {
+                const uint64 star = word ^ (ones * '*');
+                stop |= (star - ones) & ~star;
+            }
+
+            if ((stop & highBits) != 0)
+            {
+                break;
+            }
+            p += sizeof(uint64);
+        }
+    }
+
+    while (p < last)
+    {
+        const OLECHAR ch = (OLECHAR)*p;
+        if (ch >= 0x80 || ch == kchNWL || ch == kchRET || ch == kchNUL || (stopAtStar && ch == '*'))
+        {
+            break;
+        }
+        p++;
+    }
+    return p;
+}
+
 /*****************************************************************************
 *
 *  Consume a C-style comment.
@@ -1454,6 +1505,7 @@ tokens Scanner<EncodingPolicy>::SkipComment(EncodedCharPtr *pp, /* out */ bool*
 
     for (;;)
     {
+        p = SkipCommentRun<true>(p, last);
         switch((ch = this->ReadFirst(p, last)))
         {
         case '*':
@@ -1703,6 +1755,11 @@ tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
         case 0x000C:
         case 0x0020:
             Assert(chType == _C_WSP);
+            // Consume the rest of an indentation run here rather than one unit per trip through the loop.
+            while (p < last && (*p == 0x0020 || *p == 0x0009))
+            {
+                p++;
+            }
             continue;
 
         case '.':
@@ -1998,6 +2055,7 @@ tokens Scanner<EncodingPolicy>::ScanCore(bool identifyKwds)
                 pchT = NULL;
                 for (;;)
                 {
+                    p = SkipCommentRun<false>(p, last);
                     switch ((ch = this->ReadFirst(p, last)))
                     {
                     case kchLS:         // 0x2028, classifies as new line
@@ -0,0 +1,230 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#include "RuntimeBasePch.h"
+#include "Language/JavascriptStackWalker.h"
+#include "Base/SamplingHeapProfiler.h"
+
+SamplingHeapProfiler::SamplingHeapProfiler(ThreadContext * threadContext) :
+    threadContext(threadContext),
+    frames(&HeapAllocator::Instance),
+    functionNumberToFrameMap(&HeapAllocator::Instance),
+    stackNodes(&HeapAllocator::Instance),
+    stackNodeMap(&HeapAllocator::Instance)
+{
+    StackNode root = { 0, 0 };
+    this->stackNodes.Add(root);
+}
+
+SamplingHeapProfiler::~SamplingHeapProfiler()
+{
+    Assert(!this->threadContext->GetRecycler()->GetAllocationSampler()->IsEnabled());
+
+    this->frames.Map([](int index, Frame const& frame)
+    {
+        HeapDeleteArray(wcslen(frame.functionName) + 1, frame.functionName);
+        HeapDeleteArray(wcslen(frame.url) + 1, frame.url);
+    });
+}
+
+void
+SamplingHeapProfiler::Start(size_t samplingInterval)
+{
+    this->threadContext->GetRecycler()->GetAllocationSampler()->Start(samplingInterval, &SamplingHeapProfiler::SampleCallback, this);
+}
+
+void
+SamplingHeapProfiler::Stop()
+{
+    this->threadContext->GetRecycler()->GetAllocationSampler()->Stop();
+}
+
+char16 *
+SamplingHeapProfiler::CopyString(const char16 * str)
+{
+    if (str == nullptr)
+    {
+        str = _u("");
+    }
+
+    size_t length = wcslen(str) + 1;
+    char16 * copy = HeapNewArray(char16, length);
+    wcscpy_s(copy, length, str);
+    return copy;
+}
+
+uint
+SamplingHeapProfiler::SampleCallback(void * callbackState, void * address, size_t size)
+{
+    SamplingHeapProfiler * profiler = (SamplingHeapProfiler *)callbackState;
+
+    try
+    {
+        return profiler->RecordStack();
+    }
+    catch (Js::OutOfMemoryException)
+    {
+        // The allocation being sampled may be a no-throw one; attribute the sample to the root instead
+        return 0;
+    }
+}
+
+uint
+SamplingHeapProfiler::RecordStack()
+{
+    if (this->threadContext->GetScriptEntryExit() == nullptr)
+    {
+        return 0;
+    }
+
+    // Walk from the innermost frame out, then insert the frames from the outermost one in so that
+    // stacks sharing a prefix share nodes.
+    uint stack[MaxStackDepth];
+    uint depth = 0;
+
+    Js::JavascriptStackWalker walker(this->threadContext->GetScriptEntryExit()->scriptContext);
+    while (depth < MaxStackDepth && walker.Walk())
+    {
+        if (walker.IsJavascriptFrame())
+        {
+            Js::FunctionBody * functionBody = walker.GetCurrentFunction()->GetFunctionBody();
+            if (functionBody != nullptr)
+            {
+                stack[depth++] = this->GetFrame(functionBody);
+            }
+        }
+    }
+
+    uint node = 0;
+    while (depth > 0)
+    {
+        node = this->GetStackNode(node, stack[--depth]);
+    }
+    return node;
+}
+
+uint
+SamplingHeapProfiler::GetFrame(Js::FunctionBody * functionBody)
+{
+    // Function numbers are unique within the thread context and are never reused, unlike the address of the
+    // function body, so they can outlive the function.
+    uint frameIndex;
+    if (this->functionNumberToFrameMap.TryGetValue(functionBody->GetFunctionNumber(), &frameIndex))
+    {
+        return frameIndex;
+    }
+
+    Frame frame;
+    frame.functionName = CopyString(functionBody->GetExternalDisplayName());
+    frame.url = nullptr;
+    try
+    {
+        frame.url = CopyString(functionBody->GetSourceName());
+        frame.line = functionBody->GetLineNumber();
+        frame.column = functionBody->GetColumnNumber();
+        frameIndex = (uint)this->frames.Add(frame);
+    }
+    catch (Js::OutOfMemoryException)
+    {
+        HeapDeleteArray(wcslen(frame.functionName) + 1, frame.functionName);
+        if (frame.url != nullptr)
+        {
+            HeapDeleteArray(wcslen(frame.url) + 1, frame.url);
+        }
+        throw;
+    }
+
+    this->functionNumberToFrameMap.Add(functionBody->GetFunctionNumber(), frameIndex);
+    return frameIndex;
+}
+
+uint
+SamplingHeapProfiler::GetStackNode(uint parent, uint frame)
+{
+    const uint64 key = ((uint64)parent << 32) | frame;
+    uint node;
+    if (!this->stackNodeMap.TryGetValue(key, &node))
+    {
+        StackNode stackNode = { parent, frame };
+        node = (uint)this->stackNodes.Add(stackNode);
+        this->stackNodeMap.Add(key, node);
+    }
+    return node;
+}
+
+Js::Var
+SamplingHeapProfiler::GetProfile(Js::ScriptContext * scriptContext)
+{
+    struct NodeTotal
+    {
+        double count;
+        double size;
+    };
+
+    // Total up the live samples before creating any script object: those allocations can be sampled too,
+    // which adds samples and stack nodes.
+    RecyclerAllocationSampler * sampler = this->threadContext->GetRecycler()->GetAllocationSampler();
+    const double samplingInterval = (double)sampler->GetSamplingInterval();
+    const uint nodeCount = (uint)this->stackNodes.Count();
+    AutoArrayPtr<NodeTotal> totals(HeapNewArrayZ(NodeTotal, nodeCount), nodeCount);
+
+    sampler->MapLiveSamples([&](void * address, size_t size, uint node)
+    {
+        Assert(node < nodeCount);
+
+        // An object of this size is sampled with probability 1 - e^(-size/interval); scale each sample by the
+        // inverse to estimate what was allocated at this stack.
+        const double weight = 1.0 / (1.0 - exp(-(double)size / samplingInterval));
+        totals[node].count += weight;
+        totals[node].size += weight * size;
+    });
+
+    Js::JavascriptLibrary * library = scriptContext->GetLibrary();
+    const Js::PropertyId samplingIntervalId = scriptContext->GetOrAddPropertyIdTracked(_u("samplingInterval"));
+    const Js::PropertyId allocationsId = scriptContext->GetOrAddPropertyIdTracked(_u("allocations"));
+    const Js::PropertyId sizeId = scriptContext->GetOrAddPropertyIdTracked(_u("size"));
+    const Js::PropertyId countId = scriptContext->GetOrAddPropertyIdTracked(_u("count"));
+    const Js::PropertyId stackId = scriptContext->GetOrAddPropertyIdTracked(_u("stack"));
+    const Js::PropertyId functionNameId = scriptContext->GetOrAddPropertyIdTracked(_u("functionName"));
+    const Js::PropertyId urlId = scriptContext->GetOrAddPropertyIdTracked(_u("url"));
+    const Js::PropertyId lineId = scriptContext->GetOrAddPropertyIdTracked(_u("line"));
+    const Js::PropertyId columnId = scriptContext->GetOrAddPropertyIdTracked(_u("column"));
+
+    Js::DynamicObject * profile = library->CreateObject();
+    profile->SetProperty(samplingIntervalId, Js::JavascriptNumber::ToVar((uint64)sampler->GetSamplingInterval(), scriptContext), Js::PropertyOperation_None, NULL);
+
+    Js::JavascriptArray * allocations = library->CreateArray();
+    uint32 allocationCount = 0;
+    for (uint node = 0; node < nodeCount; node++)
+    {
+        if (totals[node].count == 0)
+        {
+            continue;
+        }
+
+        Js::DynamicObject * allocation = library->CreateObject();
+        allocation->SetProperty(sizeId, Js::JavascriptNumber::ToVar((uint64)totals[node].size, scriptContext), Js::PropertyOperation_None, NULL);
+        allocation->SetProperty(countId, Js::JavascriptNumber::ToVar((uint64)totals[node].count, scriptContext), Js::PropertyOperation_None, NULL);
+
+        // Innermost frame first
+        Js::JavascriptArray * stack = library->CreateArray();
+        uint32 depth = 0;
+        for (uint current = node; current != 0; current = this->stackNodes.Item(current).parent)
+        {
+            const Frame frame = this->frames.Item(this->stackNodes.Item(current).frame);
+            Js::DynamicObject * frameObject = library->CreateObject();
+            frameObject->SetProperty(functionNameId, Js::JavascriptString::NewCopySz(frame.functionName, scriptContext), Js::PropertyOperation_None, NULL);
+            frameObject->SetProperty(urlId, Js::JavascriptString::NewCopySz(frame.url, scriptContext), Js::PropertyOperation_None, NULL);
+            frameObject->SetProperty(lineId, Js::JavascriptNumber::ToVar(frame.line, scriptContext), Js::PropertyOperation_None, NULL);
+            frameObject->SetProperty(columnId, Js::JavascriptNumber::ToVar(frame.column, scriptContext), Js::PropertyOperation_None, NULL);
+            stack->SetItem(depth++, frameObject, Js::PropertyOperation_None);
+        }
+        allocation->SetProperty(stackId, stack, Js::PropertyOperation_None, NULL);
+
+        allocations->SetItem(allocationCount++, allocation, Js::PropertyOperation_None);
+    }
+    profile->SetProperty(allocationsId, allocations, Js::PropertyOperation_None, NULL);
+
+    return profile;
+}
@@ -0,0 +1,51 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+#pragma once
+
+// Attributes the allocations sampled by the recycler's allocation sampler to the script stack that made them.
+// Samples are taken from inside recycler allocations, so recording one only uses heap memory; script objects
+// are created only when the profile is requested.
+class SamplingHeapProfiler
+{
+public:
+    static const uint MaxStackDepth = 64;
+
+    SamplingHeapProfiler(ThreadContext * threadContext);
+    ~SamplingHeapProfiler();
+
+    void Start(size_t samplingInterval);
+    void Stop();
+
+    Js::Var GetProfile(Js::ScriptContext * scriptContext);
+
+private:
+    struct Frame
+    {
+        char16 * functionName;
+        char16 * url;
+        uint line;
+        uint column;
+    };
+
+    // Stacks are stored as a tree of frames; node 0 is the root and stands for an allocation made with no
+    // script on the stack.
+    struct StackNode
+    {
+        uint parent;
+        uint frame;
+    };
+
+    static uint SampleCallback(void * callbackState, void * address, size_t size);
+    uint RecordStack();
+    uint GetFrame(Js::FunctionBody * functionBody);
+    uint GetStackNode(uint parent, uint frame);
+    static char16 * CopyString(const char16 * str);
+
+    ThreadContext * threadContext;
+    JsUtil::List<Frame, HeapAllocator> frames;
+    JsUtil::BaseDictionary<uint, uint, HeapAllocator> functionNumberToFrameMap;
+    JsUtil::List<StackNode, HeapAllocator> stackNodes;
+    JsUtil::BaseDictionary<uint64, uint, HeapAllocator> stackNodeMap;
+};
@@ -285,6 +285,7 @@ namespace Js
         byteCodeAuxiliaryDataSize = 0;
         byteCodeAuxiliaryContextDataSize = 0;
         memset(byteCodeHistogram, 0, sizeof(byteCodeHistogram));
+        byteCodePairHistogram = nullptr;
 #endif
 
 #if DBG || defined(RUNTIME_DATA_COLLECTION)
@@ -5831,6 +5832,24 @@ ScriptContext::GetJitFuncRangeCache()
         dest.hash = TAGHASH((hash_t)dest.str);
     }
 
+#if DBG_DUMP
+    void ScriptContext::RecordByteCodePair(OpCode previous, OpCode current)
+    {
+        if (!Configuration::Global.flags.BytecodePairHist)
+        {
+            return;
+        }
+
+        const uint opCount = (uint)OpCode::ByteCodeLast;
+        Assert((uint)previous < opCount && (uint)current < opCount);
+        if (byteCodePairHistogram == nullptr)
+        {
+            byteCodePairHistogram = AnewArrayZ(GeneralAllocator(), uint, opCount * opCount);
+        }
+        byteCodePairHistogram[(uint)previous * opCount + (uint)current]++;
+    }
+#endif
+
     void ScriptContext::PrintStats()
     {
 
@@ -5943,6 +5962,54 @@ ScriptContext::GetJitFuncRangeCache()
             Output::Print(_u("Unique opcodes: %d\n"), unique);
         }
 
+        if (Configuration::Global.flags.BytecodePairHist && byteCodePairHistogram != nullptr)
+        {
+            const uint opCount = (uint)OpCode::ByteCodeLast;
+            const uint maxPairsPrinted = 50;
+
+            Output::Print(_u("ByteCode Pair Histogram\n"));
+            Output::Print(_u("\n"));
+
+            uint64 total = 0;
+            for (uint j = 0; j < opCount * opCount; j++)
+            {
+                total += byteCodePairHistogram[j];
+            }
+            Output::Print(_u("%9llu                     Total executed pairs\n"), total);
+            Output::Print(_u("\n"));
+
+            // Keep the indices of the hottest pairs sorted by count, hottest first; the histogram itself is left intact.
+            uint topPairs[maxPairsPrinted];
+            uint topPairCount = 0;
+            for (uint j = 0; j < opCount * opCount; j++)
+            {
+                const uint count = byteCodePairHistogram[j];
+                if (count == 0 || (topPairCount == maxPairsPrinted && count <= byteCodePairHistogram[topPairs[topPairCount - 1]]))
+                {
+                    continue;
+                }
+
+                uint insertAt = topPairCount < maxPairsPrinted ? topPairCount++ : maxPairsPrinted - 1;
+                while (insertAt > 0 && byteCodePairHistogram[topPairs[insertAt - 1]] < count)
+                {
+                    topPairs[insertAt] = topPairs[insertAt - 1];
+                    insertAt--;
+                }
+                topPairs[insertAt] = j;
+            }
+
+            for (uint printed = 0; printed < topPairCount; printed++)
+            {
+                const uint index = topPairs[printed];
+                const uint count = byteCodePairHistogram[index];
+                const OpCode first = (OpCode)(index / opCount);
+                const OpCode second = (OpCode)(index % opCount);
+                Output::Print(_u("%9u  %5.1lf  %04x %04x %s + %s\n"), count, ((double)count) / total * 100,
+                    first, second, OpCodeUtil::GetOpCodeName(first), OpCodeUtil::GetOpCodeName(second));
+            }
+            Output::Print(_u("\n"));
+        }
+
 #endif
 
 #if ENABLE_NATIVE_CODEGEN
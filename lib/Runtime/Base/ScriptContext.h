@@ -647,6 +647,8 @@ namespace Js
         uint byteCodeAuxiliaryDataSize;
         uint byteCodeAuxiliaryContextDataSize;
         uint byteCodeHistogram[static_cast<uint>(OpCode::ByteCodeLast)];
+        uint * byteCodePairHistogram;
+        void RecordByteCodePair(OpCode previous, OpCode current);
         uint32 forinCache;
         uint32 forinNoCache;
 #endif
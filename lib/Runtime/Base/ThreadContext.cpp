@@ -23,6 +23,7 @@
 #include "Language/InterpreterStackFrame.h"
 #include "Language/JavascriptStackWalker.h"
 #include "Base/ScriptMemoryDumper.h"
+#include "Base/SamplingHeapProfiler.h"
 
 #if DBG
 #include "Memory/StressTest.h"
@@ -101,6 +102,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     threadService(threadServiceCallback),
     isOptimizedForManyInstances(Js::Configuration::Global.flags.OptimizeForManyInstances),
     bgJit(Js::Configuration::Global.flags.BgJit),
+    numaNode(NUMA_NO_PREFERRED_NODE),
     pageAllocator(allocationPolicyManager, PageAllocatorType_Thread, Js::Configuration::Global.flags, 0, RecyclerHeuristic::Instance.DefaultMaxFreePageCount,
         false
 #if ENABLE_BACKGROUND_PAGE_FREEING
@@ -114,6 +116,7 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
     jobProcessor(nullptr),
 #endif
     interruptPoller(nullptr),
+    samplingHeapProfiler(nullptr),
     expirableCollectModeGcCount(-1),
     expirableObjectList(nullptr),
     expirableObjectDisposeList(nullptr),
@@ -177,6 +180,8 @@ ThreadContext::ThreadContext(AllocationPolicyManager * allocationPolicyManager,
 #endif
 #endif
     dynamicObjectEnumeratorCacheMap(&HeapAllocator::Instance, 16),
+    validatedNewFunctionSourceMap(&HeapAllocator::Instance),
+    validatedNewFunctionSourceChars(0),
     //threadContextFlags(ThreadContextFlagNoFlag),
 #ifdef NTBUILD
     telemetryBlock(&localTelemetryBlock),
@@ -304,6 +309,25 @@ void ThreadContext::SetStackProber(StackProber * stackProber)
     }
 }
 
+void ThreadContext::SetNumaNode(DWORD numaNode)
+{
+    // Memory already allocated stays where it is; new segments and the helper threads follow the node
+    this->numaNode = numaNode;
+    this->pageAllocator.SetNumaNode(numaNode);
+    if (this->recycler != nullptr)
+    {
+        this->recycler->SetNumaNode(numaNode);
+    }
+
+#if ENABLE_NATIVE_CODEGEN
+    // The job processor shared by thread bound contexts is not kept here, as it serves other threads too
+    if (this->jobProcessor != nullptr && this->jobProcessor->ProcessesInBackground())
+    {
+        static_cast<JsUtil::BackgroundJobProcessor *>(this->jobProcessor)->SetNumaNode(numaNode);
+    }
+#endif
+}
+
 size_t ThreadContext::GetScriptStackLimit() const
 {
     return stackProber->GetScriptStackLimit();
@@ -414,12 +438,16 @@ ThreadContext::~ThreadContext()
         LeakReport::DumpUrl(this->threadId);
     }
 #endif
+    ClearValidatedNewFunctionSources();
+
     if (interruptPoller)
     {
         HeapDelete(interruptPoller);
         interruptPoller = nullptr;
     }
 
+    StopSamplingHeapProfiler();
+
 #if DBG
     // ThreadContext dtor may be running on a different thread.
     // Recycler may call finalizer that free temp Arenas, which will free pages back to
@@ -721,6 +749,7 @@ Recycler* ThreadContext::EnsureRecycler()
         AutoRecyclerPtr newRecycler(HeapNew(Recycler, GetAllocationPolicyManager(), &pageAllocator, Js::Throw::OutOfMemory, Js::Configuration::Global.flags, &recyclerTelemetryHostInterface));
         newRecycler->Initialize(isOptimizedForManyInstances, &threadService); // use in-thread GC when optimizing for many instances
         newRecycler->SetCollectionWrapper(this);
+        newRecycler->SetNumaNode(this->numaNode);
 
 #if ENABLE_NATIVE_CODEGEN
         // This may throw, so it needs to be after the recycler is initialized,
@@ -1359,7 +1388,9 @@ ThreadContext::GetJobProcessor()
     {
         if(bgJit && !isOptimizedForManyInstances)
         {
-            jobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, GetAllocationPolicyManager(), &threadService, false /*disableParallelThreads*/);
+            JsUtil::BackgroundJobProcessor * backgroundJobProcessor = HeapNew(JsUtil::BackgroundJobProcessor, GetAllocationPolicyManager(), &threadService, false /*disableParallelThreads*/);
+            backgroundJobProcessor->SetNumaNode(this->numaNode);
+            jobProcessor = backgroundJobProcessor;
         }
         else
         {
@@ -1368,6 +1399,34 @@ ThreadContext::GetJobProcessor()
     }
     return jobProcessor;
 }
+
+#if DBG_DUMP
+void
+JitQueueStats::Print() const
+{
+    LARGE_INTEGER freq;
+    QueryPerformanceFrequency(&freq);
+    const double msPerTick = 1000.0 / (double)freq.QuadPart;
+
+    Output::Print(_u("JIT queue stats:\n"));
+    Output::Print(_u("  Max full JIT queue depth: %d (threshold %d), dropped: %d\n"),
+        maxFullJitQueueDepth, CONFIG_FLAG(JitQueueThreshold), droppedCount);
+
+    const char16 *const tierNames[] = { _u("SimpleJit"), _u("FullJit") };
+    CompileAssert(_countof(tierNames) == TierCount);
+    for (uint i = 0; i < TierCount; i++)
+    {
+        const TierStats &tier = tiers[i];
+        Output::Print(_u("  %-9s queued: %6d  compiled: %6d  avg wait: %10.3f ms  avg compile: %10.3f ms\n"),
+            tierNames[i],
+            tier.queuedCount,
+            tier.compiledCount,
+            tier.compiledCount ? (double)tier.waitTicks * msPerTick / tier.compiledCount : 0.0,
+            tier.compiledCount ? (double)tier.compileTicks * msPerTick / tier.compiledCount : 0.0);
+    }
+    Output::Flush();
+}
+#endif
 #endif
 
 void
@@ -3670,8 +3729,11 @@ ThreadContext::InvalidatePropertyGuardEntry(const Js::PropertyRecord* propertyRe
             if (caller != nullptr && Js::ScriptFunction::Test(caller) && !stackWalker.GetCurrentFrameFromBailout())
             {
                 BYTE dummy;
-                Js::FunctionEntryPointInfo* functionEntryPoint = caller->GetFunctionBody()->GetDefaultFunctionEntryPointInfo();
-                if (functionEntryPoint->IsInNativeAddressRange((DWORD_PTR)stackWalker.GetInstructionPointer()))
+                // The frame may be running an entry point that is no longer the default one, e.g. after a rejit
+                // while the old code was still on the stack. It registered its dependencies all the same.
+                Js::FunctionEntryPointInfo* functionEntryPoint =
+                    caller->GetFunctionBody()->GetEntryPointFromNativeAddress((DWORD_PTR)stackWalker.GetInstructionPointer());
+                if (functionEntryPoint != nullptr)
                 {
                     if (entry->entryPoints->TryGetValue(functionEntryPoint, &dummy))
                     {
@@ -4486,6 +4548,31 @@ void ThreadContext::CheckInterruptPoll()
     }
 }
 
+void ThreadContext::StartSamplingHeapProfiler(size_t samplingInterval)
+{
+    // Restarting drops the samples taken so far
+    StopSamplingHeapProfiler();
+
+    this->samplingHeapProfiler = HeapNew(SamplingHeapProfiler, this);
+    this->samplingHeapProfiler->Start(samplingInterval);
+}
+
+void ThreadContext::StopSamplingHeapProfiler()
+{
+    if (this->samplingHeapProfiler != nullptr)
+    {
+        this->samplingHeapProfiler->Stop();
+        HeapDelete(this->samplingHeapProfiler);
+        this->samplingHeapProfiler = nullptr;
+    }
+}
+
+Js::Var ThreadContext::GetSamplingHeapProfile(Js::ScriptContext* scriptContext)
+{
+    Assert(this->samplingHeapProfiler != nullptr);
+    return this->samplingHeapProfiler->GetProfile(scriptContext);
+}
+
 void *
 ThreadContext::GetDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType)
 {
@@ -4499,6 +4586,68 @@ ThreadContext::AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicTy
     this->dynamicObjectEnumeratorCacheMap.Item(dynamicType, cache);
 }
 
+bool
+ThreadContext::IsValidatedNewFunctionSource(char16 const * source, charcount_t sourceLength, charcount_t formalsLength, uint functionKind)
+{
+    ValidatedNewFunctionSource key;
+    key.source = source;
+    key.sourceLength = sourceLength;
+    key.formalsLength = formalsLength;
+    key.functionKind = functionKind;
+    key.hash = JsUtil::CharacterBuffer<char16>::InternalGetHashCode<true>(source, sourceLength);
+
+    return this->validatedNewFunctionSourceMap.ContainsKey(key);
+}
+
+void
+ThreadContext::AddValidatedNewFunctionSource(char16 const * source, charcount_t sourceLength, charcount_t formalsLength, uint functionKind)
+{
+    if (sourceLength > MaxValidatedNewFunctionSourceChars)
+    {
+        return;
+    }
+
+    if (this->validatedNewFunctionSourceMap.Count() >= MaxValidatedNewFunctionSourceCount ||
+        this->validatedNewFunctionSourceChars + sourceLength > MaxValidatedNewFunctionSourceChars)
+    {
+        // Simple bounded policy: start over once the budget is exhausted.
+        ClearValidatedNewFunctionSources();
+    }
+
+    char16 * sourceCopy = HeapNewNoThrowArray(char16, sourceLength);
+    if (sourceCopy == nullptr)
+    {
+        // The cache is only an optimization
+        return;
+    }
+    js_wmemcpy_s(sourceCopy, sourceLength, source, sourceLength);
+
+    ValidatedNewFunctionSource key;
+    key.source = sourceCopy;
+    key.sourceLength = sourceLength;
+    key.formalsLength = formalsLength;
+    key.functionKind = functionKind;
+    key.hash = JsUtil::CharacterBuffer<char16>::InternalGetHashCode<true>(sourceCopy, sourceLength);
+
+    if (this->validatedNewFunctionSourceMap.AddNew(key, true) == -1)
+    {
+        HeapDeleteArray(sourceLength, sourceCopy);
+        return;
+    }
+    this->validatedNewFunctionSourceChars += sourceLength;
+}
+
+void
+ThreadContext::ClearValidatedNewFunctionSources()
+{
+    this->validatedNewFunctionSourceMap.Map([](ValidatedNewFunctionSource const& key, bool)
+    {
+        HeapDeleteArray(key.sourceLength, const_cast<char16 *>(key.source));
+    });
+    this->validatedNewFunctionSourceMap.Clear();
+    this->validatedNewFunctionSourceChars = 0;
+}
+
 InterruptPoller::InterruptPoller(ThreadContext *tc) :
     threadContext(tc),
     lastPollTick(0),
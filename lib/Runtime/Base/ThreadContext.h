@@ -29,6 +29,7 @@ class ThreadServiceWrapper;
 struct IActiveScriptProfilerHeapEnum;
 class DynamicProfileMutator;
 class StackProber;
+class SamplingHeapProfiler;
 
 enum DisableImplicitFlags : BYTE
 {
@@ -301,6 +302,83 @@ class ThreadConfiguration
     }
 };
 
+#if ENABLE_NATIVE_CODEGEN
+// Counters for the JIT queues of the script contexts of a thread, kept in release builds so hosts can
+// tune the queue threshold and tier-up settings. They are updated from both the foreground and the
+// background JIT threads, so updates are interlocked. Times are in performance counter ticks, and are
+// only taken with -JitQueueStats or once a host has asked for the stats, to keep the performance
+// counter reads off the queueing path otherwise.
+class JitQueueStats
+{
+public:
+    enum Tier
+    {
+        SimpleJitTier,
+        FullJitTier,
+        TierCount
+    };
+
+    struct TierStats
+    {
+        LONG queuedCount;
+        LONG compiledCount;
+        LONG64 waitTicks;
+        LONG64 compileTicks;
+    };
+
+    JitQueueStats() { memset(this, 0, sizeof(*this)); timingEnabled = CONFIG_FLAG(JitQueueStats); }
+
+    bool IsTimingEnabled() const { return timingEnabled; }
+    void EnableTiming() { timingEnabled = true; }
+
+    void RecordQueued(const Tier tier)
+    {
+        InterlockedIncrement(&tiers[tier].queuedCount);
+    }
+
+    // Jobs are not always queued with the job processor lock held, so the maximum is kept with a compare-exchange
+    void RecordQueueDepth(const uint fullJitQueueDepth)
+    {
+        LONG maxDepth = maxFullJitQueueDepth;
+        while ((LONG)fullJitQueueDepth > maxDepth)
+        {
+            const LONG previousMaxDepth = InterlockedCompareExchange(&maxFullJitQueueDepth, (LONG)fullJitQueueDepth, maxDepth);
+            if (previousMaxDepth == maxDepth)
+            {
+                break;
+            }
+            maxDepth = previousMaxDepth;
+        }
+    }
+
+    void RecordDropped()
+    {
+        InterlockedIncrement(&droppedCount);
+    }
+
+    void RecordCompiled(const Tier tier, const LONG64 waitTicks, const LONG64 compileTicks)
+    {
+        InterlockedIncrement(&tiers[tier].compiledCount);
+        InterlockedExchangeAdd64(&tiers[tier].waitTicks, waitTicks);
+        InterlockedExchangeAdd64(&tiers[tier].compileTicks, compileTicks);
+    }
+
+    const TierStats &GetTierStats(const Tier tier) const { return tiers[tier]; }
+    LONG GetDroppedCount() const { return droppedCount; }
+    LONG GetMaxFullJitQueueDepth() const { return maxFullJitQueueDepth; }
+
+#if DBG_DUMP
+    void Print() const;
+#endif
+
+private:
+    TierStats tiers[TierCount];
+    LONG droppedCount;
+    LONG maxFullJitQueueDepth;
+    bool timingEnabled;
+};
+#endif
+
 class AutoReentrancyHandler;
 
 class ThreadContext sealed :
@@ -354,6 +432,8 @@ class ThreadContext sealed :
         }
         this->isThreadBound = true;
     }
+    void SetNumaNode(DWORD numaNode);
+    DWORD GetNumaNode() const { return this->numaNode; }
     bool IsJSRT() const { return !this->isThreadBound; }
     virtual bool IsThreadBound() const override { return this->isThreadBound; }
     void SetStackProber(StackProber * stackProber);
@@ -690,6 +770,7 @@ class ThreadContext sealed :
 
 #if ENABLE_NATIVE_CODEGEN
     JsUtil::JobProcessor *jobProcessor;
+    JitQueueStats jitQueueStats;
     Js::Var * bailOutRegisterSaveSpace;
 #if !FLOATVAR
     CodeGenNumberThreadAllocator * codeGenNumberThreadAllocator;
@@ -756,6 +837,7 @@ class ThreadContext sealed :
     bool hasCollectionCallBack;
     bool isOptimizedForManyInstances;
     bool bgJit;
+    DWORD numaNode;
 
     // We report library code to profiler only if called directly by user code. Not if called by library implementation.
     bool isProfilingUserCode;
@@ -818,6 +900,41 @@ class ThreadContext sealed :
     typedef JsUtil::BaseDictionary<Js::DynamicType const *, void *, HeapAllocator, PowerOf2SizePolicy> DynamicObjectEnumeratorCacheMap;
     DynamicObjectEnumeratorCacheMap dynamicObjectEnumeratorCacheMap;
 
+    // Source of a `new Function` whose formals and body passed syntax validation. The result of the
+    // validation only depends on the text and the function kind, so it is shared by all the script
+    // contexts on this thread. The cache owns the character buffer.
+    struct ValidatedNewFunctionSource
+    {
+        char16 const * source;
+        charcount_t sourceLength;
+        charcount_t formalsLength;
+        uint functionKind;
+        hash_t hash;
+
+        bool operator==(ValidatedNewFunctionSource const& other) const
+        {
+            return this->hash == other.hash &&
+                this->sourceLength == other.sourceLength &&
+                this->formalsLength == other.formalsLength &&
+                this->functionKind == other.functionKind &&
+                wmemcmp(this->source, other.source, this->sourceLength) == 0;
+        }
+
+        operator hash_t() const
+        {
+            return hash;
+        }
+    };
+
+    static const uint MaxValidatedNewFunctionSourceCount = 256;
+    static const charcount_t MaxValidatedNewFunctionSourceChars = 1024 * 1024;
+
+    typedef JsUtil::BaseDictionary<ValidatedNewFunctionSource, bool, HeapAllocator, PowerOf2SizePolicy> ValidatedNewFunctionSourceMap;
+    ValidatedNewFunctionSourceMap validatedNewFunctionSourceMap;
+    charcount_t validatedNewFunctionSourceChars;
+
+    void ClearValidatedNewFunctionSources();
+
 #ifdef NTBUILD
     ThreadContextWatsonTelemetryBlock localTelemetryBlock;
     ThreadContextWatsonTelemetryBlock * telemetryBlock;
@@ -933,6 +1050,11 @@ class ThreadContext sealed :
     void CheckScriptInterrupt();
     void CheckInterruptPoll();
 
+    void StartSamplingHeapProfiler(size_t samplingInterval);
+    void StopSamplingHeapProfiler();
+    bool IsSamplingHeapProfilerRunning() const { return samplingHeapProfiler != nullptr; }
+    Js::Var GetSamplingHeapProfile(Js::ScriptContext* scriptContext);
+
     bool DoInterruptProbe(Js::FunctionBody *const func) const
     {
         return
@@ -1221,6 +1343,7 @@ class ThreadContext sealed :
     bool IsNativeAddressHelper(void * pCodeAddr, Js::ScriptContext* currentScriptContext);
     BOOL IsNativeAddress(void * pCodeAddr, Js::ScriptContext* currentScriptContext = nullptr);
     JsUtil::JobProcessor *GetJobProcessor();
+    JitQueueStats * GetJitQueueStats() { return &jitQueueStats; }
     Js::Var * GetBailOutRegisterSaveSpace() const { return bailOutRegisterSaveSpace; }
     virtual intptr_t GetBailOutRegisterSaveSpaceAddr() const override { return (intptr_t)bailOutRegisterSaveSpace; }
 #if !FLOATVAR
@@ -1697,6 +1820,9 @@ class ThreadContext sealed :
 
     void * GetDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType);
     void AddDynamicObjectEnumeratorCache(Js::DynamicType const * dynamicType, void * cache);
+
+    bool IsValidatedNewFunctionSource(char16 const * source, charcount_t sourceLength, charcount_t formalsLength, uint functionKind);
+    void AddValidatedNewFunctionSource(char16 const * source, charcount_t sourceLength, charcount_t formalsLength, uint functionKind);
 public:
     bool IsScriptActive() const { return isScriptActive; }
     void SetIsScriptActive(bool isActive) { isScriptActive = isActive; }
@@ -1771,6 +1897,7 @@ class ThreadContext sealed :
     void CreateNoCasePropertyMap();
 
     InterruptPoller *interruptPoller;
+    SamplingHeapProfiler *samplingHeapProfiler;
 
     void CollectionCallBack(RecyclerCollectCallBackFlags flags);
 
@@ -6,7 +6,7 @@
 // NOTE: If there is a merge conflict the correct fix is to make a new GUID.
 // This file was generated with tools/regenByteCode.py
 
-// {d31c196c-a985-4c41-a9b3-5a895b7dc567}
+// {f2ed6fa0-37be-492c-97bc-d17242af762c}
 const GUID byteCodeCacheReleaseFileVersion =
-{ 0xd31c196c, 0xa985, 0x4c41, {0xa9, 0xb3, 0x5a, 0x89, 0x5b, 0x7d, 0xc5, 0x67 } };
+{ 0xf2ed6fa0, 0x37be, 0x492c, {0x97, 0xbc, 0xd1, 0x72, 0x42, 0xaf, 0x76, 0x2c } };
 
@@ -9975,6 +9975,20 @@ void EmitForInOrForOf(ParseNodeForInOrForOf *loopNode, ByteCodeGenerator *byteCo
     byteCodeGenerator->Writer()->Reg1(Js::OpCode::LdFalse, shouldCallReturnFunctionLocation);
     byteCodeGenerator->Writer()->Reg1(Js::OpCode::LdFalse, shouldCallReturnFunctionLocationFinally);
 
+    // Built-in Map and Set iterators are stepped in place and hand back a result object that the iterator
+    // reuses, since for-of never lets the result escape. The op leaves undefined for any other iterator and we fall
+    // through to the call, which keeps its call site profile so the JIT can still inline 'next'.
+    // Library code is left alone so that the precompiled JsBuiltIn bytecode does not change.
+    Js::ByteCodeLabel skipNextCall = Js::Constants::NoByteCodeLabel;
+    if (!isForAwaitOf
+        && !funcInfo->byteCodeFunction->GetUtf8SourceInfo()->GetIsLibraryCode()
+        && !PHASE_OFF(Js::BuiltInIteratorNextPhase, funcInfo->byteCodeFunction))
+    {
+        skipNextCall = byteCodeGenerator->Writer()->DefineLabel();
+        byteCodeGenerator->Writer()->Reg3(Js::OpCode::BuiltInIteratorNext, loopNode->itemLocation, loopNode->location, nextMethodReg);
+        byteCodeGenerator->Writer()->BrReg2(Js::OpCode::BrSrNeq_A, skipNextCall, loopNode->itemLocation, funcInfo->undefinedConstantRegister);
+    }
+
     // Call next on the iterator
     EmitFunctionCall(
         loopNode->itemLocation,
@@ -9983,6 +9997,11 @@ void EmitForInOrForOf(ParseNodeForInOrForOf *loopNode, ByteCodeGenerator *byteCo
         byteCodeGenerator,
         funcInfo);
 
+    if (skipNextCall != Js::Constants::NoByteCodeLabel)
+    {
+        byteCodeGenerator->Writer()->MarkLabel(skipNextCall);
+    }
+
     // If this is a for-await-of then await the iterator next result
     if (isForAwaitOf)
         EmitAwait(loopNode->itemLocation, loopNode->itemLocation, byteCodeGenerator, funcInfo);
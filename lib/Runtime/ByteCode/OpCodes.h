@@ -861,6 +861,7 @@ MACRO_BACKEND_ONLY(BigIntLiteral, Empty, None) // Load BigInt literal
 MACRO_EXTEND_WMS(Conv_Numeric, Reg2, OpSideEffect | OpTempNumberProducing | OpTempNumberTransfer | OpTempObjectSources | OpOpndHasImplicitCall | OpProducesNumber) // Convert to Numeric. [[ToNumeric()]]
 MACRO_EXTEND_WMS(Incr_Num_A, Reg2, OpTempNumberProducing | OpOpndHasImplicitCall | OpDoNotTransfer | OpTempNumberSources | OpTempObjectSources | OpCanCSE | OpPostOpDbgBailOut | OpProducesNumber)     // Increment Numeric
 MACRO_EXTEND_WMS(Decr_Num_A, Reg2, OpTempNumberProducing | OpOpndHasImplicitCall | OpDoNotTransfer | OpTempNumberSources | OpTempObjectSources | OpCanCSE | OpPostOpDbgBailOut | OpProducesNumber)     // Increment Numeric
+MACRO_EXTEND_WMS(       BuiltInIteratorNext, Reg3,          OpSideEffect)                                   // for-of step over a built-in Map/Set iterator; undefined if 'next' is not the built-in
 MACRO_BACKEND_ONLY(LazyBailOutThunkLabel, Empty, None)
 
 // Jitting Generator
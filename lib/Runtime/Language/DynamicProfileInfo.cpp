@@ -53,6 +53,17 @@ namespace Js
         bits = NotNativeIntBit | NotNativeFloatBit;
     }
 
+    void ArrayCallSiteInfo::RecordHeadSegmentSize(uint32 size)
+    {
+        uint32 inlineChunkSize = SparseArraySegmentBase::INLINE_CHUNK_SIZE;
+        size = min(size, inlineChunkSize);
+        if (size > headSegmentSizeHint)
+        {
+            OUTPUT_TRACE(Js::ArrayPresizePhase, _u("RecordHeadSegmentSize: %u -> %u\n"), headSegmentSizeHint, size);
+            headSegmentSizeHint = (byte)size;
+        }
+    }
+
     CriticalSection DynamicProfileInfo::callSiteInfoCS;
 
     DynamicProfileInfo* DynamicProfileInfo::New(Recycler* recycler, FunctionBody* functionBody, bool persistsAcrossScriptContexts)
@@ -62,6 +73,7 @@ namespace Js
         {
             { (uint)offsetof(DynamicProfileInfo, callSiteInfo), functionBody->GetProfiledCallSiteCount() * sizeof(CallSiteInfo) },
             { (uint)offsetof(DynamicProfileInfo, callApplyTargetInfo), functionBody->GetProfiledCallApplyCallSiteCount() * sizeof(CallSiteInfo) },
+            { (uint)offsetof(DynamicProfileInfo, callSiteFrequency), functionBody->GetProfiledCallSiteCount() * sizeof(uint32) },
             { (uint)offsetof(DynamicProfileInfo, ldLenInfo), functionBody->GetProfiledLdLenCount() * sizeof(LdLenInfo) },
             { (uint)offsetof(DynamicProfileInfo, ldElemInfo), functionBody->GetProfiledLdElemCount() * sizeof(LdElemInfo) },
             { (uint)offsetof(DynamicProfileInfo, stElemInfo), functionBody->GetProfiledStElemCount() * sizeof(StElemInfo) },
@@ -718,6 +730,12 @@ namespace Js
             this->m_recursiveInlineInfo = this->m_recursiveInlineInfo | (1 << callSiteId);
         }
 
+        // Call edge frequency, used by the inliner to weigh this call site against the caller's other call sites
+        if (callSiteFrequency && callSiteFrequency[callSiteId] != UINT32_MAX)
+        {
+            callSiteFrequency[callSiteId]++;
+        }
+
         if (!callSiteInfo[callSiteId].isPolymorphic)
         {
             Js::SourceId oldSourceId = callSiteInfo[callSiteId].u.functionData.sourceId;
@@ -1670,8 +1688,9 @@ namespace Js
             {
                 Output::Print(i != 0 && (i % 10) == 0 ? _u("\n                          ") : _u(" "));
                 Output::Print(_u("%4d:"), i);
-                Output::Print(_u("  Function Number:  %2d, CallSite Number:  %2d, IsNativeIntArray:  %2d, IsNativeFloatArray:  %2d"),
-                    arrayCallSiteInfo[i].functionNumber, arrayCallSiteInfo[i].callSiteNumber, !arrayCallSiteInfo[i].isNotNativeInt, !arrayCallSiteInfo[i].isNotNativeFloat);
+                Output::Print(_u("  Function Number:  %2d, CallSite Number:  %2d, IsNativeIntArray:  %2d, IsNativeFloatArray:  %2d, HeadSegmentSizeHint:  %2d"),
+                    arrayCallSiteInfo[i].functionNumber, arrayCallSiteInfo[i].callSiteNumber, !arrayCallSiteInfo[i].isNotNativeInt, !arrayCallSiteInfo[i].isNotNativeFloat,
+                    arrayCallSiteInfo[i].headSegmentSizeHint);
                 Output::Print(_u("\n"));
             }
             Output::Print(_u("\n"));
@@ -2479,6 +2498,7 @@ namespace Js
             dynamicProfileInfo->slotInfo = slotInfo;
             dynamicProfileInfo->callSiteInfo = callSiteInfo;
             dynamicProfileInfo->callApplyTargetInfo = callApplyTargetInfo;
+            dynamicProfileInfo->callSiteFrequency = nullptr; // Call edge frequencies are only meaningful for the current run and are not serialized
             dynamicProfileInfo->divideTypeInfo = divTypeInfo;
             dynamicProfileInfo->switchTypeInfo = switchTypeInfo;
             dynamicProfileInfo->returnTypeInfo = returnTypeInfo;
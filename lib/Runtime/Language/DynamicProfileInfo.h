@@ -369,6 +369,9 @@ namespace Js
             };
             byte bits;
         };
+        // Largest inline head segment size that a native array allocated at this site grew its head segment to.
+        // Array literals allocated here later start out with a head segment of that size.
+        byte headSegmentSizeHint;
 #if DBG
         uint functionNumber;
         ProfileId callSiteNumber;
@@ -381,6 +384,9 @@ namespace Js
         void SetIsNotNativeFloatArray();
         void SetIsNotNativeArray();
 
+        uint32 GetHeadSegmentSizeHint() const { return PHASE_OFF1(ArrayPresizePhase) ? 0 : headSegmentSizeHint; }
+        void RecordHeadSegmentSize(uint32 size);
+
         static uint32 GetOffsetOfBits() { return offsetof(ArrayCallSiteInfo, bits); }
         static byte const NotNativeIntBit = 1;
         static byte const NotNativeFloatBit = 2;
@@ -469,6 +475,8 @@ namespace Js
         bool MayHaveNonBuiltinCallee(ProfileId callSiteId);
         FunctionInfo * GetCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, bool *isPolymorphicCall);
         CallSiteInfo * GetCallSiteInfo() const { return callSiteInfo; }
+        bool HasCallSiteFrequencies() const { return callSiteFrequency != nullptr; }
+        uint32 GetCallSiteFrequency(ProfileId callSiteId) const { return callSiteFrequency ? callSiteFrequency[callSiteId] : 0; }
         uint16 GetConstantArgInfo(ProfileId callSiteId);
         uint GetLdFldCacheIndexFromCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId);
         bool GetPolymorphicCallSiteInfo(FunctionBody* functionBody, ProfileId callSiteId, bool *isConstructorCall, __inout_ecount(functionBodyArrayLength) FunctionBody** functionBodyArray, uint functionBodyArrayLength);
@@ -536,6 +544,7 @@ namespace Js
         Field(DynamicProfileFunctionInfo *) dynamicProfileFunctionInfo;
         Field(CallSiteInfo *) callSiteInfo;
         Field(CallSiteInfo *) callApplyTargetInfo;
+        Field(uint32 *) callSiteFrequency; // number of profiled calls made through each call site, saturating
         Field(ValueType *) returnTypeInfo; // return type of calls for non inline call sites
         Field(ValueType *) divideTypeInfo;
         Field(ValueType *) switchTypeInfo;
@@ -20,7 +20,7 @@ DynamicProfileStorage::InfoMap DynamicProfileStorage::infoMap(&NoCheckHeapAlloca
 DynamicProfileStorage::TimeType DynamicProfileStorage::creationTime = DynamicProfileStorage::TimeType();
 int32 DynamicProfileStorage::lastOffset = 0;
 DWORD const DynamicProfileStorage::MagicNumber = 20100526;
-DWORD const DynamicProfileStorage::FileFormatVersion = 2;
+DWORD const DynamicProfileStorage::FileFormatVersion = 3;
 DWORD DynamicProfileStorage::nextFileId = 0;
 bool DynamicProfileStorage::locked = false;
 
@@ -296,6 +296,7 @@ EXDEF2_WMS(SET_ELEM_ENVSLOTNonVar,  StEnvObjSlotChkUndecl,      OP_StEnvObjSlotC
   DEF3_WMS(CALL,                    NewScObject,                OP_NewScObject, CallI)
   DEF3_WMS(CUSTOM_L_R0,             NewScObjectNoCtorFull,      OP_NewScObjectNoCtorFull, Reg2)
 EXDEF2_WMS(A1toA1Mem,               LdCustomSpreadIteratorList, JavascriptOperators::OP_LdCustomSpreadIteratorList)
+EXDEF2_WMS(A2toA1Mem,               BuiltInIteratorNext,        JavascriptOperators::OP_BuiltInIteratorNext)
 EXDEF3_WMS(CALL,                    NewScObjectSpread,          OP_NewScObjectSpread, CallIExtended)
   DEF3_WMS(CALL,                    NewScObjArray,              OP_NewScObjArray, CallI)
   DEF3_WMS(CALL,                    NewScObjArraySpread,        OP_NewScObjArraySpread, CallIExtended)
@@ -1212,6 +1212,9 @@ namespace Js
 #if DBG
         newInstance->m_outParamsEnd = outparamsEnd;
 #endif
+#if DBG_DUMP
+        newInstance->DEBUG_previousOpCode = OpCode::ByteCodeLast;
+#endif
 
         bool doInterruptProbe = newInstance->scriptContext->GetThreadContext()->DoInterruptProbe(this->executeFunction);
 #if ENABLE_NATIVE_CODEGEN
@@ -2583,6 +2586,15 @@ namespace Js
     {
 #if DBG_DUMP
         that->scriptContext->byteCodeHistogram[(int)op]++;
+        if (!OpCodeUtil::IsPrefixOpcode(op))
+        {
+            // Prefixes are folded into the opcode that follows them, so only real opcodes form a pair.
+            if (that->DEBUG_previousOpCode != OpCode::ByteCodeLast)
+            {
+                that->scriptContext->RecordByteCodePair(that->DEBUG_previousOpCode, op);
+            }
+            that->DEBUG_previousOpCode = op;
+        }
         if (PHASE_TRACE(Js::InterpreterPhase, that->m_functionBody))
         {
             Output::Print(_u("%d.%d:Executing %s at offset 0x%X\n"), that->m_functionBody->GetSourceContextId(), that->m_functionBody->GetLocalFunctionId(), Js::OpCodeUtil::GetOpCodeName(op), that->DEBUG_currentByteOffset);
@@ -169,6 +169,9 @@ namespace Js
 #if DBG || DBG_DUMP
         void * DEBUG_currentByteOffset;
 #endif
+#if DBG_DUMP
+        Js::OpCode DEBUG_previousOpCode;
+#endif
 #if DBG
         Var* m_outParamsEnd;
 #endif
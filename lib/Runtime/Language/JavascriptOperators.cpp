@@ -17,6 +17,12 @@
 
 #include "Library/ForInObjectEnumerator.h"
 #include "Library/ES5Array.h"
+#include "Library/SameValueComparer.h"
+#include "Library/MapOrSetDataList.h"
+#include "Library/JavascriptMap.h"
+#include "Library/JavascriptSet.h"
+#include "Library/JavascriptMapIterator.h"
+#include "Library/JavascriptSetIterator.h"
 #include "Types/SimpleDictionaryPropertyDescriptor.h"
 #include "Types/SimpleDictionaryTypeHandler.h"
 #include "Language/ModuleNamespace.h"
@@ -1610,6 +1616,37 @@ using namespace Js;
         JIT_HELPER_END(Op_ToSpreadedFunctionArgument);
     }
 
+    // for-of step over an unmodified Map or Set iterator. 'next' is the method for-of loaded from the
+    // iterator before the loop. When it is this realm's built-in Map/Set iterator next, step the iterator
+    // directly and return the result object the iterator reuses for for-of. Otherwise return undefined; the
+    // caller then calls 'next' as usual.
+    Var JavascriptOperators::OP_BuiltInIteratorNext(Var iterator, Var next, ScriptContext* scriptContext)
+    {
+        JIT_HELPER_NOT_REENTRANT_HEADER(Op_BuiltInIteratorNext, reentrancylock, scriptContext->GetThreadContext());
+
+        JavascriptLibrary* library = scriptContext->GetLibrary();
+
+        if (!VarIs<JavascriptFunction>(next) || UnsafeVarTo<JavascriptFunction>(next)->GetScriptContext() != scriptContext)
+        {
+            return library->GetUndefined();
+        }
+
+        FunctionInfo* nextInfo = UnsafeVarTo<JavascriptFunction>(next)->GetFunctionInfo();
+
+        if (nextInfo == &JavascriptMapIterator::EntryInfo::Next && VarIs<JavascriptMapIterator>(iterator))
+        {
+            return UnsafeVarTo<JavascriptMapIterator>(iterator)->GetNextForOf(library);
+        }
+
+        if (nextInfo == &JavascriptSetIterator::EntryInfo::Next && VarIs<JavascriptSetIterator>(iterator))
+        {
+            return UnsafeVarTo<JavascriptSetIterator>(iterator)->GetNextForOf(library);
+        }
+
+        return library->GetUndefined();
+        JIT_HELPER_END(Op_BuiltInIteratorNext);
+    }
+
     BOOL JavascriptOperators::IsPropertyUnscopable(Var instanceVar, JavascriptString *propertyString)
     {
         // This never gets called.
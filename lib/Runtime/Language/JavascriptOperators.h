@@ -123,6 +123,7 @@ namespace Js
         static RecyclableObject* ToObject(Var aRight,ScriptContext* scriptContext);
         static Var ToUnscopablesWrapperObject(Var aRight, ScriptContext* scriptContext);
         static Var OP_LdCustomSpreadIteratorList(Var aRight, ScriptContext* scriptContext);
+        static Var OP_BuiltInIteratorNext(Var iterator, Var next, ScriptContext* scriptContext);
         static Var ToNumber(Var aRight,ScriptContext* scriptContext);
         static Var ToNumberInPlace(Var aRight,ScriptContext* scriptContext, JavascriptNumber* result);
         static Var ToNumeric(Var aRight, ScriptContext* scriptContext);
@@ -488,25 +488,36 @@ using namespace Js;
             arrayInfo->SetIsNotNativeArray();
         }
 
+        const uint32 headSegmentSizeHint = arrayInfo->GetHeadSegmentSizeHint();
+#if ENABLE_DEBUG_CONFIG_OPTIONS
+        if (Js::Configuration::Global.flags.TestTrace.IsEnabled(Js::ArrayPresizePhase) &&
+            headSegmentSizeHint > (length ? length : SparseArraySegmentBase::SMALL_CHUNK_SIZE))
+        {
+            Output::Print(_u("Presize array literal: func(%s) callsite(%d) length(%d) headSegmentSize(%d)\n"),
+                functionBody->GetDisplayName(), profileId, length, headSegmentSizeHint);
+            Output::Flush();
+        }
+#endif
+
         ScriptContext *const scriptContext = functionBody->GetScriptContext();
         JavascriptArray *array;
         if (arrayInfo->IsNativeIntArray())
         {
-            JavascriptNativeIntArray *const intArray = scriptContext->GetLibrary()->CreateNativeIntArrayLiteral(length);
+            JavascriptNativeIntArray *const intArray = scriptContext->GetLibrary()->CreateNativeIntArrayLiteral(length, headSegmentSizeHint);
             Recycler *recycler = scriptContext->GetRecycler();
             intArray->SetArrayCallSite(profileId, recycler->CreateWeakReferenceHandle(functionBody));
             array = intArray;
         }
         else if (arrayInfo->IsNativeFloatArray())
         {
-            JavascriptNativeFloatArray *const floatArray = scriptContext->GetLibrary()->CreateNativeFloatArrayLiteral(length);
+            JavascriptNativeFloatArray *const floatArray = scriptContext->GetLibrary()->CreateNativeFloatArrayLiteral(length, headSegmentSizeHint);
             Recycler *recycler = scriptContext->GetRecycler();
             floatArray->SetArrayCallSite(profileId, recycler->CreateWeakReferenceHandle(functionBody));
             array = floatArray;
         }
         else
         {
-            array = scriptContext->GetLibrary()->CreateArrayLiteral(length);
+            array = scriptContext->GetLibrary()->CreateArrayLiteral(length, headSegmentSizeHint);
         }
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
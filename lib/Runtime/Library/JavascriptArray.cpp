@@ -955,19 +955,19 @@ using namespace Js;
         JIT_HELPER_NOT_REENTRANT_HEADER(ScrArr_ProfiledNewScArray, reentrancylock, scriptContext->GetThreadContext());
         if (arrayInfo->IsNativeIntArray())
         {
-            JavascriptNativeIntArray *arr = scriptContext->GetLibrary()->CreateNativeIntArrayLiteral(elementCount);
+            JavascriptNativeIntArray *arr = scriptContext->GetLibrary()->CreateNativeIntArrayLiteral(elementCount, arrayInfo->GetHeadSegmentSizeHint());
             arr->SetArrayProfileInfo(weakFuncRef, arrayInfo);
             return arr;
         }
 
         if (arrayInfo->IsNativeFloatArray())
         {
-            JavascriptNativeFloatArray *arr = scriptContext->GetLibrary()->CreateNativeFloatArrayLiteral(elementCount);
+            JavascriptNativeFloatArray *arr = scriptContext->GetLibrary()->CreateNativeFloatArrayLiteral(elementCount, arrayInfo->GetHeadSegmentSizeHint());
             arr->SetArrayProfileInfo(weakFuncRef, arrayInfo);
             return arr;
         }
 
-        JavascriptArray *arr = scriptContext->GetLibrary()->CreateArrayLiteral(elementCount);
+        JavascriptArray *arr = scriptContext->GetLibrary()->CreateArrayLiteral(elementCount, arrayInfo->GetHeadSegmentSizeHint());
         return arr;
         JIT_HELPER_END(ScrArr_ProfiledNewScArray);
     }
@@ -2542,6 +2542,15 @@ using namespace Js;
         }
     }
 
+    void JavascriptNativeArray::RecordHeadSegmentSize(uint32 size)
+    {
+        ArrayCallSiteInfo *arrayInfo = this->GetArrayCallSiteInfo();
+        if (arrayInfo)
+        {
+            arrayInfo->RecordHeadSegmentSize(size);
+        }
+    }
+
     void JavascriptNativeArray::CopyArrayProfileInfo(Js::JavascriptNativeArray* baseArray)
     {
         if (baseArray->weakRefToFuncBody)
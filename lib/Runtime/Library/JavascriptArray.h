@@ -407,7 +407,7 @@ namespace Js
         template<typename unitType, typename className, uint inlineSlots>
         static className* New(uint32 length, DynamicType* arrayType, Recycler* recycler);
         template<typename unitType, typename className, uint inlineSlots>
-        static className* NewLiteral(uint32 length, DynamicType* arrayType, Recycler* recycler);
+        static className* NewLiteral(uint32 length, DynamicType* arrayType, Recycler* recycler, uint32 headSegmentSizeHint = 0);
 #if ENABLE_COPYONACCESS_ARRAY
         template<typename unitType, typename className, uint inlineSlots>
         static className* NewCopyOnAccessLiteral(DynamicType* arrayType, ArrayCallSiteInfo *arrayInfo, FunctionBody *functionBody, const Js::AuxArray<int32> *ints, Recycler* recycler);
@@ -587,6 +587,7 @@ namespace Js
         template<typename T> bool NeedScanForMissingValuesUponSetItem(SparseArraySegment<T> *const segment, const uint32 offset) const;
         template<typename T> void ScanForMissingValues(const uint startIndex = 0);
         template<typename T> bool ScanForMissingValues(const uint startIndex, const uint endIndex);
+        void RecordHeadSegmentGrowth(const uint32 oldSize, const uint32 newSize);
         template<typename T, uint InlinePropertySlots> static SparseArraySegment<typename T::TElement> *InitArrayAndHeadSegment(T *const array, const uint32 length, const uint32 size, const bool wasZeroAllocated);
         template<typename T> static void SliceHelper(JavascriptArray*pArr, JavascriptArray* pNewArr, uint32 start, uint32 newLen);
 
@@ -1029,6 +1030,7 @@ namespace Js
 #if ENABLE_PROFILE_INFO
         void SetArrayProfileInfo(RecyclerWeakReference<FunctionBody> *weakRef, ArrayCallSiteInfo *arrayInfo);
         void CopyArrayProfileInfo(Js::JavascriptNativeArray* baseArray);
+        void RecordHeadSegmentSize(uint32 size);
 #endif
 
         Var FindMinOrMax(Js::ScriptContext * scriptContext, bool findMax);
@@ -217,7 +217,7 @@ namespace Js
     //
     /*static*/
     template<typename unitType, typename className, uint inlineSlots>
-    className* JavascriptArray::NewLiteral(uint32 length, DynamicType* arrayType, Recycler* recycler)
+    className* JavascriptArray::NewLiteral(uint32 length, DynamicType* arrayType, Recycler* recycler, uint32 headSegmentSizeHint)
     {
         CompileAssert(static_cast<PropertyIndex>(inlineSlots) == inlineSlots);
         Assert(DynamicTypeHandler::RoundUpInlineSlotCapacity(static_cast<PropertyIndex>(inlineSlots)) == inlineSlots);
@@ -227,17 +227,14 @@ namespace Js
         {
             size_t allocationPlusSize;
             uint alignedInlineElementSlots;
-            if(!length)
+            uint32 allocLength = length ? length : SparseArraySegmentBase::SMALL_CHUNK_SIZE;
+            if (headSegmentSizeHint > allocLength)
             {
-                DetermineAllocationSize<className, inlineSlots>(
-                    SparseArraySegmentBase::SMALL_CHUNK_SIZE,
-                    &allocationPlusSize,
-                    &alignedInlineElementSlots);
-            }
-            else
-            {
-                DetermineAllocationSize<className, inlineSlots>(length, &allocationPlusSize, &alignedInlineElementSlots);
+                // Arrays allocated at this call site grew their head segment, start out with one that size instead
+                Assert(HasInlineHeadSegment(headSegmentSizeHint));
+                allocLength = headSegmentSizeHint;
             }
+            DetermineAllocationSize<className, inlineSlots>(allocLength, &allocationPlusSize, &alignedInlineElementSlots);
 
             // alignedInlineElementSlots is actually the 'size' of the segment. The size of the segment should not be greater than InlineHead segment limit, otherwise the inline
             // segment may not be interpreted as inline segment if the length extends to the size.
@@ -1507,6 +1504,10 @@ namespace Js
                     {
                         ScanForMissingValues<T>();
                     }
+                    else if (currentWasHead)
+                    {
+                        RecordHeadSegmentGrowth(oldSegment->size, current->size);
+                    }
 
                     if (isInlineSegment)
                     {
@@ -1535,6 +1536,7 @@ namespace Js
                     this->ClearElements(head, 0);
                 }
 
+                RecordHeadSegmentGrowth(head->size, current->size);
                 head = current;
 
                 SetHasNoMissingValues(false);
@@ -1563,6 +1565,18 @@ namespace Js
 #endif
     }
 
+    inline void JavascriptArray::RecordHeadSegmentGrowth(const uint32 oldSize, const uint32 newSize)
+    {
+#if ENABLE_PROFILE_INFO
+        // Only head segments that can be allocated inline are presized, so once the head has outgrown
+        // that there is nothing left to learn and the call site isn't looked up again.
+        if (oldSize < SparseArraySegmentBase::INLINE_CHUNK_SIZE && JavascriptNativeArray::Is(this->GetTypeId()))
+        {
+            static_cast<JavascriptNativeArray *>(this)->RecordHeadSegmentSize(newSize);
+        }
+#endif
+    }
+
     template<typename T>
     bool JavascriptArray::NeedScanForMissingValuesUponSetItem(SparseArraySegment<T> *const segment, const uint32 offset) const
     {
@@ -1652,6 +1666,7 @@ namespace Js
             // SetHeadAndLastUsedSegment which asserts if a segment map exists.
             ClearSegmentMap();
             SetHeadAndLastUsedSegment(current);
+            RecordHeadSegmentGrowth(oldCurrent->size, current->size);
 
             if (isInlineSegment)
             {
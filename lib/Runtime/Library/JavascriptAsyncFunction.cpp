@@ -58,11 +58,6 @@ JavascriptPromise* JavascriptAsyncFunction::BeginAsyncFunctionExecution(Javascri
     auto* scriptContext = generator->GetScriptContext();
     auto* promise = library->CreatePromise();
 
-    auto* stepFn = library->CreateAsyncSpawnStepFunction(
-        EntryAsyncSpawnStepNextFunction,
-        generator,
-        library->GetUndefined());
-
     JavascriptExceptionObject* exception = nullptr;
     JavascriptPromiseResolveOrRejectFunction* resolve;
     JavascriptPromiseResolveOrRejectFunction* reject;
@@ -70,7 +65,7 @@ JavascriptPromise* JavascriptAsyncFunction::BeginAsyncFunctionExecution(Javascri
 
     try
     {
-        AsyncSpawnStep(stepFn, generator, resolve, reject);
+        AsyncSpawnStep(generator, library->GetUndefined(), ResumeYieldKind::Normal, nullptr, resolve, reject);
     }
     catch (const JavascriptException& err)
     {
@@ -118,22 +113,24 @@ Var JavascriptAsyncFunction::EntryAsyncSpawnCallStepFunction(
 
     auto* stepFn = VarTo<JavascriptAsyncSpawnStepFunction>(function);
 
-    JavascriptMethod method = stepFn->isReject
-        ? EntryAsyncSpawnStepThrowFunction
-        : EntryAsyncSpawnStepNextFunction;
-    
-    auto* nextStepFn = library->CreateAsyncSpawnStepFunction(
-        method,
+    // Resume the generator directly instead of going through a step function
+    // allocated for this single resumption.
+    AsyncSpawnStep(
         stepFn->generator,
-        resolvedValue);
+        resolvedValue,
+        stepFn->isReject ? ResumeYieldKind::Throw : ResumeYieldKind::Normal,
+        stepFn,
+        stepFn->resolve,
+        stepFn->reject);
 
-    AsyncSpawnStep(nextStepFn, stepFn->generator, stepFn->resolve, stepFn->reject);
     return undefinedVar;
 }
 
 void JavascriptAsyncFunction::AsyncSpawnStep(
-    JavascriptAsyncSpawnStepFunction* stepFunction,
     JavascriptGenerator* generator,
+    Var argument,
+    ResumeYieldKind resumeKind,
+    JavascriptAsyncSpawnStepFunction* resumingFunction,
     Var resolve,
     Var reject)
 {
@@ -148,12 +145,7 @@ void JavascriptAsyncFunction::AsyncSpawnStep(
 
     try
     {
-        Var resultVar = CALL_FUNCTION(
-            scriptContext->GetThreadContext(),
-            stepFunction,
-            CallInfo(CallFlags_Value, 1),
-            undefinedVar);
-
+        Var resultVar = generator->CallGenerator(argument, resumeKind);
         result = VarTo<RecyclableObject>(resultVar);
     }
     catch (const JavascriptException& err)
@@ -193,21 +185,42 @@ void JavascriptAsyncFunction::AsyncSpawnStep(
     }
 
 
-    // Chain off the yielded promise and step again
-    auto* successFunction = library->CreateAsyncSpawnStepFunction(
-        EntryAsyncSpawnCallStepFunction,
-        generator,
-        undefinedVar,
-        resolve,
-        reject);
-
-    auto* failFunction = library->CreateAsyncSpawnStepFunction(
-        EntryAsyncSpawnCallStepFunction,
-        generator,
-        undefinedVar,
-        resolve,
-        reject,
-        true);
+    // Chain off the yielded promise and step again. The success/fail functions only
+    // capture state that is fixed for the whole execution of the async function, so
+    // the pair created for the first await is reused by all the following ones.
+    JavascriptAsyncSpawnStepFunction* successFunction;
+    JavascriptAsyncSpawnStepFunction* failFunction;
+    JavascriptAsyncSpawnStepFunction* pairedFunction = nullptr;
+    if (resumingFunction != nullptr)
+    {
+        pairedFunction = resumingFunction->pairedFunction;
+    }
+
+    if (pairedFunction != nullptr)
+    {
+        successFunction = resumingFunction->isReject ? pairedFunction : resumingFunction;
+        failFunction = resumingFunction->isReject ? resumingFunction : pairedFunction;
+    }
+    else
+    {
+        successFunction = library->CreateAsyncSpawnStepFunction(
+            EntryAsyncSpawnCallStepFunction,
+            generator,
+            undefinedVar,
+            resolve,
+            reject);
+
+        failFunction = library->CreateAsyncSpawnStepFunction(
+            EntryAsyncSpawnCallStepFunction,
+            generator,
+            undefinedVar,
+            resolve,
+            reject,
+            true);
+
+        successFunction->pairedFunction = failFunction;
+        failFunction->pairedFunction = successFunction;
+    }
 
     auto* promise = JavascriptPromise::InternalPromiseResolve(value, scriptContext);
     auto* unused = JavascriptPromise::UnusedPromiseCapability(scriptContext);
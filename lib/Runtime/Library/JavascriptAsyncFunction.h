@@ -67,8 +67,10 @@ class JavascriptAsyncFunction : public JavascriptGeneratorFunction
 
 private:
     static void AsyncSpawnStep(
-        JavascriptAsyncSpawnStepFunction* nextFunction,
         JavascriptGenerator* generator,
+        Var argument,
+        ResumeYieldKind resumeKind,
+        JavascriptAsyncSpawnStepFunction* resumingFunction,
         Var resolve,
         Var reject);
 };
@@ -96,7 +98,8 @@ class JavascriptAsyncSpawnStepFunction : public RuntimeFunction
             argument(argument),
             resolve(resolve),
             reject(reject),
-            isReject(isReject) {}
+            isReject(isReject),
+            pairedFunction(nullptr) {}
 
     Field(JavascriptGenerator*) generator;
     Field(Var) reject;
@@ -104,6 +107,9 @@ class JavascriptAsyncSpawnStepFunction : public RuntimeFunction
     Field(bool) isReject;
     Field(Var) argument;
 
+    // For the success/fail step functions of an await, the other function of the pair
+    Field(JavascriptAsyncSpawnStepFunction*) pairedFunction;
+
 #if ENABLE_TTD
     virtual void MarkVisitKindSpecificPtrs(TTD::SnapshotExtractor* extractor) override;
     virtual TTD::NSSnapObjects::SnapObjectType GetSnapTag_TTD() const override;
@@ -197,18 +197,26 @@ using namespace Js;
         EvalMapString key(bs, sourceString, sourceLen, moduleID, strictMode, /* isLibraryCode = */ false);
         if (!scriptContext->IsInNewFunctionMap(key, &pfuncInfoCache))
         {
-            // Validate formals here
-            scriptContext->GetGlobalObject()->ValidateSyntax(
-                scriptContext, formals->GetSz(), formals->GetLength(),
-                isGenerator, isAsync,
-                &Parser::ValidateFormals);
-            if (fnBody != NULL)
-            {
-                // Validate function body
+            // Validation only depends on the source text, so a source already validated by another script
+            // context on this thread doesn't need to be reparsed.
+            ThreadContext * threadContext = scriptContext->GetThreadContext();
+            if (!threadContext->IsValidatedNewFunctionSource(sourceString, sourceLen, formals->GetLength(), (uint)functionKind))
+            {
+                // Validate formals here
                 scriptContext->GetGlobalObject()->ValidateSyntax(
-                    scriptContext, fnBody->GetSz(), fnBody->GetLength(),
+                    scriptContext, formals->GetSz(), formals->GetLength(),
                     isGenerator, isAsync,
-                    &Parser::ValidateSourceElementList);
+                    &Parser::ValidateFormals);
+                if (fnBody != NULL)
+                {
+                    // Validate function body
+                    scriptContext->GetGlobalObject()->ValidateSyntax(
+                        scriptContext, fnBody->GetSz(), fnBody->GetLength(),
+                        isGenerator, isAsync,
+                        &Parser::ValidateSourceElementList);
+                }
+
+                threadContext->AddValidatedNewFunctionSource(sourceString, sourceLen, formals->GetLength(), (uint)functionKind);
             }
 
             pfuncScript = scriptContext->GetGlobalObject()->EvalHelper(scriptContext, sourceString, sourceLen, moduleID, fscrCanDeferFncParse, Constants::FunctionCode, TRUE, TRUE, strictMode);
@@ -2083,6 +2083,9 @@ namespace Js
         /* No inlining                Array_Sort               */ library->AddFunctionToLibraryObject(arrayPrototype, PropertyIds::sort, &JavascriptArray::EntryInfo::Sort, 1);
 
         builtinFuncs[BuiltinFunction::JavascriptArray_LastIndexOf]    = library->AddFunctionToLibraryObject(arrayPrototype, PropertyIds::lastIndexOf,     &JavascriptArray::EntryInfo::LastIndexOf,       1);
+        // TODO: map, find and findIndex call their callback through CallFunction for every element. Moving them to
+        // InJavascript/Array_prototype.js, as was done for filter/forEach/some/every/reduce, lets the JIT inline them along with
+        // the callback (see InlineCallbacks). That requires regenerating the JsBuiltIn bytecode headers (tools/regenByteCode.py).
         /* No inlining                Array_Map            */ library->AddFunctionToLibraryObject(arrayPrototype, PropertyIds::map,             &JavascriptArray::EntryInfo::Map,               1);
         /* No inlining                Array_ReduceRight    */ library->AddFunctionToLibraryObject(arrayPrototype, PropertyIds::reduceRight,     &JavascriptArray::EntryInfo::ReduceRight,       1);
 
@@ -5155,6 +5158,14 @@ namespace Js
     {
         Assert(VarIs<JavascriptFunction>(taskVar));
 
+        if (this->microtaskQueue != nullptr)
+        {
+            // The host drains the queue through JsDrainMicrotasks, so there is no need to
+            // leave script and cross the host boundary for every job.
+            this->microtaskQueue->Add(taskVar);
+            return;
+        }
+
         if(this->nativeHostPromiseContinuationFunction)
         {
 #if ENABLE_TTD
@@ -5242,6 +5253,51 @@ namespace Js
         }
     }
 
+    void JavascriptLibrary::EnableMicrotaskQueue()
+    {
+        if (this->microtaskQueue == nullptr)
+        {
+            Recycler* recycler = this->GetRecycler();
+            this->microtaskQueue = RecyclerNew(recycler, MicrotaskQueue, recycler);
+            this->microtaskQueueHead = 0;
+        }
+    }
+
+    Var JavascriptLibrary::DequeueMicrotask()
+    {
+        Assert(HasPendingMicrotasks());
+
+        MicrotaskQueue* queue = this->microtaskQueue;
+        int head = this->microtaskQueueHead;
+        Var taskVar = queue->Item(head);
+        queue->Item(head, nullptr);
+        head++;
+
+        if (head == queue->Count())
+        {
+            // Drained; reuse the buffer from the start.
+            queue->Clear();
+            head = 0;
+        }
+        else if (head >= 64 && head * 2 >= queue->Count())
+        {
+            // Jobs keep enqueueing more jobs; slide the live tail down so the buffer doesn't grow without bound.
+            int pending = queue->Count() - head;
+            for (int i = 0; i < pending; i++)
+            {
+                queue->Item(i, queue->Item(head + i));
+            }
+            while (queue->Count() > pending)
+            {
+                queue->RemoveAtEnd();
+            }
+            head = 0;
+        }
+
+        this->microtaskQueueHead = head;
+        return taskVar;
+    }
+
 #ifdef ENABLE_JS_BUILTINS
 
     bool JavascriptLibrary::InitializeChakraLibraryObject(DynamicObject * chakraLibraryObject, DeferredTypeHandlerBase * typeHandler, DeferredInitializeMode mode)
@@ -5977,10 +6033,10 @@ namespace Js
         return arr;
     }
 
-    JavascriptArray* JavascriptLibrary::CreateArrayLiteral(uint32 length)
+    JavascriptArray* JavascriptLibrary::CreateArrayLiteral(uint32 length, uint32 headSegmentSizeHint)
     {
         AssertMsg(arrayType, "Where's arrayType?");
-        JavascriptArray* arr = JavascriptArray::NewLiteral<Var, JavascriptArray, 0>(length, arrayType, this->GetRecycler());
+        JavascriptArray* arr = JavascriptArray::NewLiteral<Var, JavascriptArray, 0>(length, arrayType, this->GetRecycler(), headSegmentSizeHint);
         JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_ARRAY(arr));
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -5989,10 +6045,10 @@ namespace Js
         return arr;
     }
 
-    JavascriptNativeIntArray* JavascriptLibrary::CreateNativeIntArrayLiteral(uint32 length)
+    JavascriptNativeIntArray* JavascriptLibrary::CreateNativeIntArrayLiteral(uint32 length, uint32 headSegmentSizeHint)
     {
         AssertMsg(nativeIntArrayType, "Where's arrayType?");
-        JavascriptNativeIntArray* arr = JavascriptArray::NewLiteral<int32, JavascriptNativeIntArray, 0>(length, nativeIntArrayType, this->GetRecycler());
+        JavascriptNativeIntArray* arr = JavascriptArray::NewLiteral<int32, JavascriptNativeIntArray, 0>(length, nativeIntArrayType, this->GetRecycler(), headSegmentSizeHint);
         JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_ARRAY(arr));
 
         return arr;
@@ -6009,10 +6065,10 @@ namespace Js
     }
 #endif
 
-    JavascriptNativeFloatArray* JavascriptLibrary::CreateNativeFloatArrayLiteral(uint32 length)
+    JavascriptNativeFloatArray* JavascriptLibrary::CreateNativeFloatArrayLiteral(uint32 length, uint32 headSegmentSizeHint)
     {
         AssertMsg(nativeFloatArrayType, "Where's arrayType?");
-        JavascriptNativeFloatArray* arr = JavascriptArray::NewLiteral<double, JavascriptNativeFloatArray, 0>(length, nativeFloatArrayType, this->GetRecycler());
+        JavascriptNativeFloatArray* arr = JavascriptArray::NewLiteral<double, JavascriptNativeFloatArray, 0>(length, nativeFloatArrayType, this->GetRecycler(), headSegmentSizeHint);
         JS_ETW(EventWriteJSCRIPT_RECYCLER_ALLOCATE_ARRAY(arr));
 
 #ifdef ENABLE_DEBUG_CONFIG_OPTIONS
@@ -7114,6 +7170,20 @@ namespace Js
         return CreateIteratorResultObject(GetUndefined(), GetTrue());
     }
 
+    DynamicObject* JavascriptLibrary::ReuseIteratorResultObject(DynamicObject* resultObject, Var value, bool done)
+    {
+        // The object never reaches script, so its type should never change. It may still come from
+        // another realm's library, in which case start over with one of ours.
+        if (resultObject == nullptr || resultObject->GetType() != iteratorResultType)
+        {
+            return CreateIteratorResultObject(value, done);
+        }
+
+        resultObject->SetSlot(SetSlotArguments(Js::PropertyIds::value, 0, value));
+        resultObject->SetSlot(SetSlotArguments(Js::PropertyIds::done, 1, done ? GetTrue() : GetFalse()));
+        return resultObject;
+    }
+
     JavascriptListIterator* JavascriptLibrary::CreateListIterator(ListForListIterator* list)
     {
         JavascriptListIterator* iterator = RecyclerNew(this->GetRecycler(), JavascriptListIterator, listIteratorType, list);
@@ -103,6 +103,7 @@ namespace Js
     class SharedContents;
     typedef RecyclerFastAllocator<JavascriptNumber, LeafBit> RecyclerJavascriptNumberAllocator;
     typedef JsUtil::List<Var, Recycler> ListForListIterator;
+    typedef JsUtil::List<Var, Recycler> MicrotaskQueue;
 
     class UndeclaredBlockVariable : public RecyclableObject
     {
@@ -497,6 +498,11 @@ namespace Js
 
         Field(ModuleRecordList*) moduleRecordList;
 
+        // Engine-owned promise job queue; non-null once the host opts in through JsEnableMicrotaskQueue.
+        // Jobs in [microtaskQueueHead, Count()) are pending; drained slots are nulled so they don't keep tasks alive.
+        Field(MicrotaskQueue*) microtaskQueue;
+        Field(int) microtaskQueueHead;
+
         Field(OnlyWritablePropertyProtoChainCache) typesWithOnlyWritablePropertyProtoChain;
         Field(NoSpecialPropertyProtoChainCache) typesWithNoSpecialPropertyProtoChain;
 
@@ -578,6 +584,8 @@ namespace Js
 #endif
             referencedPropertyRecords(nullptr),
             moduleRecordList(nullptr),
+            microtaskQueue(nullptr),
+            microtaskQueueHead(0),
             rootPath(nullptr),
             bindRefChunkBegin(nullptr),
             bindRefChunkCurrent(nullptr),
@@ -845,6 +853,11 @@ namespace Js
         FinalizableObject* GetJsrtContext();
         void EnqueueTask(Var taskVar);
 
+        void EnableMicrotaskQueue();
+        bool IsMicrotaskQueueEnabled() const { return this->microtaskQueue != nullptr; }
+        bool HasPendingMicrotasks() const { return this->microtaskQueue != nullptr && this->microtaskQueueHead < this->microtaskQueue->Count(); }
+        Var DequeueMicrotask();
+
         HeapArgumentsObject* CreateHeapArguments(Var frameObj, uint formalCount, bool isStrictMode = false);
         JavascriptArray* CreateArray();
         JavascriptArray* CreateArray(uint32 length);
@@ -899,14 +912,14 @@ namespace Js
         // This method would be used for creating array literals, when we really need to create a huge array
         // Avoids checks at runtime.
         //
-        JavascriptArray*            CreateArrayLiteral(uint32 length);
-        JavascriptNativeIntArray*   CreateNativeIntArrayLiteral(uint32 length);
+        JavascriptArray*            CreateArrayLiteral(uint32 length, uint32 headSegmentSizeHint = 0);
+        JavascriptNativeIntArray*   CreateNativeIntArrayLiteral(uint32 length, uint32 headSegmentSizeHint = 0);
 
 #if ENABLE_PROFILE_INFO
         JavascriptNativeIntArray*   CreateCopyOnAccessNativeIntArrayLiteral(ArrayCallSiteInfo *arrayInfo, FunctionBody *functionBody, const Js::AuxArray<int32> *ints);
 #endif
 
-        JavascriptNativeFloatArray* CreateNativeFloatArrayLiteral(uint32 length);
+        JavascriptNativeFloatArray* CreateNativeFloatArrayLiteral(uint32 length, uint32 headSegmentSizeHint = 0);
 
         JavascriptBoolean* CreateBoolean(BOOL value);
         JavascriptDate* CreateDate();
@@ -1084,6 +1097,7 @@ namespace Js
         DynamicObject* CreateIteratorResultObject(Var value, Var done);
         DynamicObject* CreateIteratorResultObject(Var value, bool done = false);
         DynamicObject* CreateIteratorResultObjectDone();
+        DynamicObject* ReuseIteratorResultObject(DynamicObject* resultObject, Var value, bool done);
 
         RecyclableObject* CreateThrowErrorObject(JavascriptError* error);
 
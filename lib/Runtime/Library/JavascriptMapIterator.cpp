@@ -10,7 +10,8 @@ namespace Js
         DynamicObject(type),
         m_map(map),
         m_mapIterator(map->GetIterator()),
-        m_kind(kind)
+        m_kind(kind),
+        m_forOfResult(nullptr)
     {
         Assert(type->GetTypeId() == TypeIds_MapIterator);
     }
@@ -33,35 +34,55 @@ namespace Js
         }
 
         JavascriptMapIterator* iterator = VarTo<JavascriptMapIterator>(thisObj);
-        JavascriptMap* map = iterator->m_map;
-        auto& mapIterator = iterator->m_mapIterator;
+        Var result;
 
-        if (map == nullptr || !mapIterator.Next())
+        if (!iterator->TryGetNext(library, &result))
         {
-            iterator->m_map = nullptr;
             return library->CreateIteratorResultObjectDone();
         }
 
+        return library->CreateIteratorResultObject(result);
+    }
+
+    bool JavascriptMapIterator::TryGetNext(JavascriptLibrary* library, Var* result)
+    {
+        JavascriptMap* map = m_map;
+        auto& mapIterator = m_mapIterator;
+
+        if (map == nullptr || !mapIterator.Next())
+        {
+            m_map = nullptr;
+            return false;
+        }
+
         auto entry = mapIterator.Current();
-        Var result;
 
-        if (iterator->m_kind == JavascriptMapIteratorKind::KeyAndValue)
+        if (m_kind == JavascriptMapIteratorKind::KeyAndValue)
         {
             JavascriptArray* keyValueTuple = library->CreateArray(2);
             keyValueTuple->SetItem(0, entry.Key(), PropertyOperation_None);
             keyValueTuple->SetItem(1, entry.Value(), PropertyOperation_None);
-            result = keyValueTuple;
+            *result = keyValueTuple;
         }
-        else if (iterator->m_kind == JavascriptMapIteratorKind::Key)
+        else if (m_kind == JavascriptMapIteratorKind::Key)
         {
-            result = entry.Key();
+            *result = entry.Key();
         }
         else
         {
-            Assert(iterator->m_kind == JavascriptMapIteratorKind::Value);
-            result = entry.Value();
+            Assert(m_kind == JavascriptMapIteratorKind::Value);
+            *result = entry.Value();
         }
 
-        return library->CreateIteratorResultObject(result);
+        return true;
+    }
+
+    DynamicObject* JavascriptMapIterator::GetNextForOf(JavascriptLibrary* library)
+    {
+        Var value = library->GetUndefined();
+        bool done = !TryGetNext(library, &value);
+
+        m_forOfResult = library->ReuseIteratorResultObject(m_forOfResult, value, done);
+        return m_forOfResult;
     }
 } //namespace Js
@@ -19,6 +19,7 @@ namespace Js
         Field(JavascriptMap*)                          m_map;
         Field(JavascriptMap::MapDataList::Iterator)    m_mapIterator;
         Field(JavascriptMapIteratorKind)               m_kind;
+        Field(DynamicObject*)                          m_forOfResult;
 
     protected:
         DEFINE_VTABLE_CTOR(JavascriptMapIterator, DynamicObject);
@@ -35,6 +36,14 @@ namespace Js
 
         static Var EntryNext(RecyclableObject* function, CallInfo callInfo, ...);
 
+        // Steps the iterator the way %MapIteratorPrototype%.next does, without creating the
+        // result object. Returns false once the map is exhausted.
+        bool TryGetNext(JavascriptLibrary* library, Var* result);
+
+        // for-of step used by OP_BuiltInIteratorNext. The {value, done} object is owned by this iterator
+        // and reused on every step, so it dies with the iterator instead of holding on to the last value.
+        DynamicObject* GetNextForOf(JavascriptLibrary* library);
+
     public:
         JavascriptMap* GetMapForHeapEnum() { return m_map; }
     };
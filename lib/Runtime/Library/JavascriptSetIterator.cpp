@@ -10,7 +10,8 @@ namespace Js
         DynamicObject(type),
         m_set(set),
         m_setIterator(set->GetIterator()),
-        m_kind(kind)
+        m_kind(kind),
+        m_forOfResult(nullptr)
     {
         Assert(type->GetTypeId() == TypeIds_SetIterator);
     }
@@ -33,31 +34,51 @@ namespace Js
         }
 
         JavascriptSetIterator* iterator = VarTo<JavascriptSetIterator>(thisObj);
-        JavascriptSet* set = iterator->m_set;
-        auto& setIterator = iterator->m_setIterator;
+        Var result;
 
-        if (set == nullptr || !setIterator.Next())
+        if (!iterator->TryGetNext(library, &result))
         {
-            iterator->m_set = nullptr;
             return library->CreateIteratorResultObjectDone();
         }
 
+        return library->CreateIteratorResultObject(result);
+    }
+
+    bool JavascriptSetIterator::TryGetNext(JavascriptLibrary* library, Var* result)
+    {
+        JavascriptSet* set = m_set;
+        auto& setIterator = m_setIterator;
+
+        if (set == nullptr || !setIterator.Next())
+        {
+            m_set = nullptr;
+            return false;
+        }
+
         auto value = setIterator.Current();
-        Var result;
 
-        if (iterator->m_kind == JavascriptSetIteratorKind::KeyAndValue)
+        if (m_kind == JavascriptSetIteratorKind::KeyAndValue)
         {
             JavascriptArray* keyValueTuple = library->CreateArray(2);
             keyValueTuple->SetItem(0, value, PropertyOperation_None);
             keyValueTuple->SetItem(1, value, PropertyOperation_None);
-            result = keyValueTuple;
+            *result = keyValueTuple;
         }
         else
         {
-            Assert(iterator->m_kind == JavascriptSetIteratorKind::Value);
-            result = value;
+            Assert(m_kind == JavascriptSetIteratorKind::Value);
+            *result = value;
         }
 
-        return library->CreateIteratorResultObject(result);
+        return true;
+    }
+
+    DynamicObject* JavascriptSetIterator::GetNextForOf(JavascriptLibrary* library)
+    {
+        Var value = library->GetUndefined();
+        bool done = !TryGetNext(library, &value);
+
+        m_forOfResult = library->ReuseIteratorResultObject(m_forOfResult, value, done);
+        return m_forOfResult;
     }
 } //namespace Js
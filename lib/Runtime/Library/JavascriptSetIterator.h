@@ -18,6 +18,7 @@ namespace Js
         Field(JavascriptSet*)                          m_set;
         Field(JavascriptSet::SetDataList::Iterator)    m_setIterator;
         Field(JavascriptSetIteratorKind)               m_kind;
+        Field(DynamicObject*)                          m_forOfResult;
 
     protected:
         DEFINE_VTABLE_CTOR(JavascriptSetIterator, DynamicObject);
@@ -34,6 +35,14 @@ namespace Js
 
         static Var EntryNext(RecyclableObject* function, CallInfo callInfo, ...);
 
+        // Steps the iterator the way %SetIteratorPrototype%.next does, without creating the
+        // result object. Returns false once the set is exhausted.
+        bool TryGetNext(JavascriptLibrary* library, Var* result);
+
+        // for-of step used by OP_BuiltInIteratorNext. The {value, done} object is owned by this iterator
+        // and reused on every step, so it dies with the iterator instead of holding on to the last value.
+        DynamicObject* GetNextForOf(JavascriptLibrary* library);
+
     public:
         JavascriptSet* GetSetForHeapEnum() { return m_set; }
     };
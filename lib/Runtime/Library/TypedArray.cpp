@@ -1362,6 +1362,140 @@ namespace Js
         return newTypedArray;
     }
 
+    // Only a number that converts to the element type without loss can be strictly equal to an element.
+    template <typename TypeName>
+    static bool TryGetTypedSearchValue(double value, TypeName * typedValue)
+    {
+        // All integer element types used by script fit in [INT32_MIN, UINT32_MAX].
+        if (!(value >= -2147483648.0 && value <= 4294967295.0))
+        {
+            return false;
+        }
+
+        int64 int64Value = (int64)value;
+        if ((double)int64Value != value || (int64)(TypeName)int64Value != int64Value)
+        {
+            return false;
+        }
+
+        *typedValue = (TypeName)int64Value;
+        return true;
+    }
+
+    template <>
+    bool TryGetTypedSearchValue(double value, float * typedValue)
+    {
+        // Finite doubles beyond the float range have no float representation (and converting them is undefined).
+        if (NumberUtilities::IsFinite(value) && (value > 3.4028234663852886e38 || value < -3.4028234663852886e38))
+        {
+            return false;
+        }
+
+        float floatValue = (float)value;
+        if ((double)floatValue != value)
+        {
+            return false;
+        }
+
+        *typedValue = floatValue;
+        return true;
+    }
+
+    template <>
+    bool TryGetTypedSearchValue(double value, double * typedValue)
+    {
+        *typedValue = value;
+        return true;
+    }
+
+    // Compare a block of elements at a time without an early exit so the compiler can vectorize the
+    // block; only a block that contains a match is rescanned element by element.
+    template <typename TypeName, typename TPredicate>
+    static uint32 FindTypedElement(const TypeName * typedBuffer, uint32 fromIndex, uint32 toIndex, TPredicate matches)
+    {
+        const uint32 blockSize = 16;
+        uint32 i = fromIndex;
+        for (; toIndex - i >= blockSize; i += blockSize)
+        {
+            bool anyMatch = false;
+            for (uint32 j = 0; j < blockSize; j++)
+            {
+                anyMatch |= matches(typedBuffer[i + j]);
+            }
+
+            if (anyMatch)
+            {
+                break;
+            }
+        }
+
+        for (; i < toIndex; i++)
+        {
+            if (matches(typedBuffer[i]))
+            {
+                return i;
+            }
+        }
+
+        return JavascriptArray::InvalidIndex;
+    }
+
+    template <typename TypeName, bool clamped, bool virtualAllocated>
+    bool TypedArray<TypeName, clamped, virtualAllocated>::TypedIndexOf(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, uint32 * foundIndex)
+    {
+        *foundIndex = JavascriptArray::InvalidIndex;
+
+        // The from index conversion can call script, which may have detached the buffer.
+        if (this->IsDetachedBuffer() || CrossSite::IsCrossSiteObjectTyped(this))
+        {
+            return false;
+        }
+
+        if (toIndex > GetLength())
+        {
+            toIndex = GetLength();
+        }
+
+        if (fromIndex >= toIndex)
+        {
+            return true;
+        }
+
+        double searchValue;
+        if (TaggedInt::Is(search))
+        {
+            searchValue = TaggedInt::ToDouble(search);
+        }
+        else if (JavascriptNumber::Is_NoTaggedIntCheck(search))
+        {
+            searchValue = JavascriptNumber::GetValue(search);
+        }
+        else
+        {
+            // No element is strictly equal (or SameValueZero) to a non-number.
+            return true;
+        }
+
+        const TypeName * typedBuffer = (const TypeName *)buffer;
+        if (JavascriptNumber::IsNan(searchValue))
+        {
+            // indexOf never finds NaN; includes finds any NaN element.
+            if (includesAlgorithm)
+            {
+                *foundIndex = FindTypedElement(typedBuffer, fromIndex, toIndex, [](TypeName element) { return element != element; });
+            }
+            return true;
+        }
+
+        TypeName typedValue;
+        if (TryGetTypedSearchValue(searchValue, &typedValue))
+        {
+            // -0 and +0 compare equal, matching both strict equality and SameValueZero.
+            *foundIndex = FindTypedElement(typedBuffer, fromIndex, toIndex, [typedValue](TypeName element) { return element == typedValue; });
+        }
+        return true;
+    }
+
     // %TypedArray%.from as described in ES6.0 (draft 22) Section 22.2.2.1
     Var TypedArrayBase::EntryFrom(RecyclableObject* function, CallInfo callInfo, ...)
     {
@@ -1924,6 +2058,16 @@ namespace Js
             return TaggedInt::ToVarUnchecked(-1);
         }
 
+        uint32 foundIndex;
+        if (typedArrayBase->TypedIndexOf(search, fromIndex, length, false, &foundIndex))
+        {
+            if (foundIndex == JavascriptArray::InvalidIndex)
+            {
+                return TaggedInt::ToVarUnchecked(-1);
+            }
+            return JavascriptNumber::ToVar(foundIndex, scriptContext);
+        }
+
         return JavascriptArray::TemplatedIndexOfHelper<false>(typedArrayBase, search, fromIndex, length, scriptContext);
     }
 
@@ -1947,6 +2091,12 @@ namespace Js
             return scriptContext->GetLibrary()->GetFalse();
         }
 
+        uint32 foundIndex;
+        if (typedArrayBase->TypedIndexOf(search, fromIndex, length, true, &foundIndex))
+        {
+            return scriptContext->GetLibrary()->CreateBoolean(foundIndex != JavascriptArray::InvalidIndex);
+        }
+
         return JavascriptArray::TemplatedIndexOfHelper<true>(typedArrayBase, search, fromIndex, length, scriptContext);
     }
 
@@ -3229,6 +3379,12 @@ namespace Js
         return BaseTypedDirectGetItem(index);
     }
 
+    template<>
+    bool Int64Array::TypedIndexOf(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, uint32 * foundIndex)
+    {
+        return false;
+    }
+
     template<>
     VTableValue Int64Array::DummyVirtualFunctionToHinderLinkerICF()
     {
@@ -3253,6 +3409,12 @@ namespace Js
         return BaseTypedDirectGetItem(index);
     }
 
+    template<>
+    bool Uint64Array::TypedIndexOf(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, uint32 * foundIndex)
+    {
+        return false;
+    }
+
     template<>
     VTableValue Uint64Array::DummyVirtualFunctionToHinderLinkerICF()
     {
@@ -3291,6 +3453,12 @@ namespace Js
         return typedBuffer[index] ? GetLibrary()->GetTrue() : GetLibrary()->GetFalse();
     }
 
+    template<>
+    bool BoolArray::TypedIndexOf(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, uint32 * foundIndex)
+    {
+        return false;
+    }
+
     template<>
     VTableValue BoolArray::DummyVirtualFunctionToHinderLinkerICF()
     {
@@ -205,6 +205,11 @@ namespace Js
         virtual void SortHelper(byte* listBuffer, uint32 length, RecyclableObject* compareFn, ScriptContext* scriptContext, ArenaAllocator* allocator) = 0;
 
         virtual Var Subarray(uint32 begin, uint32 end) = 0;
+
+        // Search the backing store for indexOf/includes without boxing each element.
+        // Returns false if the caller has to fall back to the generic search.
+        virtual bool TypedIndexOf(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, uint32 * foundIndex) { return false; }
+
         Field(int32) BYTES_PER_ELEMENT;
         Field(uint32) byteOffset;
         FieldNoBarrier(BYTE*) buffer;   // beginning of mapped array.
@@ -527,6 +532,8 @@ namespace Js
             JavascriptArray::TypedArraySort<TypeName>(list, length, &cvInfo, allocator);
         }
 
+        bool TypedIndexOf(Var search, uint32 fromIndex, uint32 toIndex, bool includesAlgorithm, uint32 * foundIndex) override;
+
     public:
         virtual VTableValue DummyVirtualFunctionToHinderLinkerICF();
     };
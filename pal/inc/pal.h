@@ -3135,6 +3135,13 @@ SetThreadPriority(
           IN HANDLE hThread,
           IN int nPriority);
 
+PALIMPORT
+DWORD_PTR
+PALAPI
+SetThreadAffinityMask(
+          IN HANDLE hThread,
+          IN DWORD_PTR dwThreadAffinityMask);
+
 PALIMPORT
 BOOL
 PALAPI
@@ -3560,6 +3567,19 @@ VirtualAllocEx(
          IN DWORD flAllocationType,
          IN DWORD flProtect);
 
+#define NUMA_NO_PREFERRED_NODE ((DWORD) -1)
+
+PALIMPORT
+LPVOID
+PALAPI
+VirtualAllocExNuma(
+         IN HANDLE hProcess,
+         IN LPVOID lpAddress,
+         IN SIZE_T dwSize,
+         IN DWORD flAllocationType,
+         IN DWORD flProtect,
+         IN DWORD nndPreferred);
+
 PALIMPORT
 BOOL
 PALAPI
@@ -3615,6 +3635,19 @@ PALAPI
 GlobalMemoryStatusEx(
             IN OUT LPMEMORYSTATUSEX lpBuffer);
 
+PALIMPORT
+BOOL
+PALAPI
+GetNumaHighestNodeNumber(
+            OUT PULONG HighestNodeNumber);
+
+PALIMPORT
+BOOL
+PALAPI
+GetNumaNodeProcessorMask(
+            IN UCHAR Node,
+            OUT PULONGLONG ProcessorMask);
+
 typedef struct _MEMORY_BASIC_INFORMATION {
     PVOID BaseAddress;
     PVOID AllocationBase_PAL_Undefined;
@@ -35,6 +35,9 @@ Module Name:
 #include <string.h>
 #include <unistd.h>
 #include <limits.h>
+#ifdef __LINUX__
+#include <sys/syscall.h>
+#endif
 
 #if HAVE_VM_ALLOCATE
 #include <mach/vm_map.h>
@@ -97,6 +100,17 @@ static int gBackingFile PAL_GLOBAL = -1;
 #define MAP_ANON MAP_ANONYMOUS
 #endif
 
+// On Linux, decommit replaces the range with a no-access MAP_NORESERVE mapping and commit just
+// mprotects it back to read/write. Replacing the mapping gives back the pages along with the commit
+// charge taken when the range was made writable; madvise(MADV_DONTNEED) would keep the mapping but
+// not release the charge, and commits would start failing with overcommit_memory=2. The new mapping
+// has no mbind policy, so decommit applies the region's preferred NUMA node to it again.
+#if defined(__linux__) && defined(MAP_NORESERVE) && !RESERVE_FROM_BACKING_FILE && !MMAP_DOESNOT_ALLOW_REMAP
+#define COMMIT_WITH_MPROTECT 1
+#else
+#define COMMIT_WITH_MPROTECT 0
+#endif
+
 /*++
 Function:
     ReserveVirtualMemory()
@@ -777,6 +791,7 @@ static BOOL VIRTUALStoreAllocationInfo(
     pNewEntry->memSize          = memSize;
     pNewEntry->allocationType   = flAllocationType;
     pNewEntry->accessProtection = flProtection;
+    pNewEntry->preferredNode    = NUMA_NO_PREFERRED_NODE;
 
     nBufferSize = memSize / VIRTUAL_PAGE_SIZE / CHAR_BIT;
     if ( ( memSize / VIRTUAL_PAGE_SIZE ) % CHAR_BIT != 0 )
@@ -1264,13 +1279,13 @@ static LPVOID VIRTUALCommitMemory(
         {
             // Commit the pages
             void * pRet = MAP_FAILED;
-#if MMAP_DOESNOT_ALLOW_REMAP
+#if MMAP_DOESNOT_ALLOW_REMAP || COMMIT_WITH_MPROTECT
             if (mprotect((void *) StartBoundary, MemSize, PROT_WRITE | PROT_READ) == 0)
                 pRet = (void *)StartBoundary;
-#else // MMAP_DOESNOT_ALLOW_REMAP
+#else // MMAP_DOESNOT_ALLOW_REMAP || COMMIT_WITH_MPROTECT
             pRet = mmap((void *) StartBoundary, MemSize, PROT_WRITE | PROT_READ,
                      MAP_ANON | MAP_FIXED | MAP_PRIVATE, -1, 0);
-#endif // MMAP_DOESNOT_ALLOW_REMAP
+#endif // MMAP_DOESNOT_ALLOW_REMAP || COMMIT_WITH_MPROTECT
             if (pRet != MAP_FAILED)
             {
 #if MMAP_DOESNOT_ALLOW_REMAP
@@ -1685,6 +1700,82 @@ VirtualAllocEx(
     return VirtualAlloc(lpAddress, dwSize, flAllocationType, flProtect);
 }
 
+/*++
+Function:
+  VIRTUALPreferNode
+
+  Applies mbind(MPOL_PREFERRED) for the node to the range. A failure is only
+  reported, as the node is a preference.
+--*/
+static void VIRTUALPreferNode(
+         IN UINT_PTR startBoundary, /* Start of the range */
+         IN SIZE_T memSize,         /* Size of the range */
+         IN DWORD nndPreferred)     /* Preferred node, or NUMA_NO_PREFERRED_NODE */
+{
+#if defined(__LINUX__) && defined(SYS_mbind)
+    // MPOL_PREFERRED comes from numaif.h, which is only installed with libnuma
+    const int MpolPreferred = 1;
+    unsigned long nodeMask[16] = { 0 };
+    const DWORD bitsPerMask = sizeof(nodeMask[0]) * 8;
+
+    // The kernel reads one bit less than the count passed in
+    if (nndPreferred < (sizeof(nodeMask) * 8) - 1)
+    {
+        nodeMask[nndPreferred / bitsPerMask] = 1UL << (nndPreferred % bitsPerMask);
+        if (syscall(SYS_mbind, (void *)startBoundary, memSize, MpolPreferred, nodeMask, sizeof(nodeMask) * 8, 0) != 0)
+        {
+            WARN("mbind failed to prefer node %u! Error(%d)=%s\n",
+                 nndPreferred, errno, strerror(errno));
+        }
+    }
+#endif
+}
+
+/*++
+Function:
+  VirtualAllocExNuma
+
+Note:
+  As on Windows the node is only a preference. On Linux it is applied to
+  the range with mbind(MPOL_PREFERRED), so pages come from other nodes once
+  the preferred node runs out of memory. The node is also kept with the
+  region, and decommit applies it again to the mapping that replaces the
+  decommitted pages, so the policy holds across decommit and commit unless
+  memory is reserved from the backing file. Elsewhere the node is ignored.
+
+See MSDN doc.
+--*/
+LPVOID
+PALAPI
+VirtualAllocExNuma(
+         IN HANDLE hProcess,
+         IN LPVOID lpAddress,       /* Region to reserve or commit */
+         IN SIZE_T dwSize,          /* Size of Region */
+         IN DWORD flAllocationType, /* Type of allocation */
+         IN DWORD flProtect,        /* Type of access protection */
+         IN DWORD nndPreferred)     /* Preferred node of the physical memory */
+{
+    LPVOID pRetVal = VirtualAlloc(lpAddress, dwSize, flAllocationType, flProtect);
+
+#if defined(__LINUX__) && defined(SYS_mbind)
+    if (pRetVal != NULL)
+    {
+        CPalThread *pthrCurrent = InternalGetCurrentThread();
+        InternalEnterCriticalSection(pthrCurrent, &virtual_critsec);
+        PCMI pInformation = VIRTUALFindRegionInformation((UINT_PTR)pRetVal);
+        if (pInformation != NULL)
+        {
+            pInformation->preferredNode = nndPreferred;
+        }
+        InternalLeaveCriticalSection(pthrCurrent, &virtual_critsec);
+
+        VIRTUALPreferNode((UINT_PTR)pRetVal, dwSize, nndPreferred);
+    }
+#endif
+
+    return pRetVal;
+}
+
 __attribute__((no_instrument_function, noinline))
 static bool PAL_Initialize_Check_Once()
 {
@@ -2096,6 +2187,11 @@ VirtualFree(
         // if no double mapping is supported,
         // just mprotect the memory with no access
         if (mprotect((LPVOID)StartBoundary, MemSize, PROT_NONE) == 0)
+#elif COMMIT_WITH_MPROTECT
+        // A fresh no-access mapping gives back the pages and the commit charge, and recommitting is then
+        // a single mprotect
+        if ( mmap( (LPVOID)StartBoundary, MemSize, PROT_NONE,
+                   MAP_FIXED | MAP_ANON | MAP_PRIVATE | MAP_NORESERVE, -1, 0 ) != MAP_FAILED )
 #else // MMAP_DOESNOT_ALLOW_REMAP
         // Explicitly calling mmap instead of mprotect here makes it
         // that much more clear to the operating system that we no
@@ -2121,6 +2217,9 @@ VirtualFree(
                 goto VirtualFreeExit;
             }
 #endif  // MMAP_ANON_IGNORES_PROTECTION && !MMAP_DOESNOT_ALLOW_REMAP
+#if COMMIT_WITH_MPROTECT
+            VIRTUALPreferNode( StartBoundary, MemSize, pUnCommittedMem->preferredNode );
+#endif  // COMMIT_WITH_MPROTECT
 
             SIZE_T index = 0;
             SIZE_T nNumOfPagesToChange = 0;
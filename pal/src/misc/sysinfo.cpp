@@ -39,6 +39,9 @@ Revision History:
 #endif
 
 #include <sys/param.h>
+#ifdef __LINUX__
+#include <fcntl.h>
+#endif
 #if HAVE_SYS_VMPARAM_H
 #include <sys/vmparam.h>
 #endif  // HAVE_SYS_VMPARAM_H
@@ -217,6 +220,120 @@ GetCurrentThreadStackLimits(&lowl, &highl);
     PERF_EXIT(GetSystemInfo);
 }
 
+#ifdef __LINUX__
+/*++
+Function:
+  CGROUPReadValue
+
+Reads the decimal value at the start of a cgroup control file. Returns FALSE if the file
+cannot be read or holds "max", which is what cgroup v2 reports when there is no limit.
+--*/
+static BOOL
+CGROUPReadValue(const char *path, UINT64 *value)
+{
+    char buf[64];
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        return FALSE;
+    }
+    ssize_t num_read = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+
+    if (num_read <= 0 || buf[0] < '0' || buf[0] > '9')
+    {
+        return FALSE;
+    }
+    buf[num_read] = '\0';
+
+    UINT64 result = 0;
+    for (const char *digit = buf; *digit >= '0' && *digit <= '9'; digit++)
+    {
+        result = result * 10 + (*digit - '0');
+    }
+    *value = result;
+    return TRUE;
+}
+
+/*++
+Function:
+  CGROUPGetMemoryInfo
+
+Gets the memory limit of the cgroup the process runs in, and how much of it is used. In a
+container, sysconf reports the memory of the whole host; the cgroup limit is what the
+process can actually use before it is reclaimed from or killed. With cgroup v2, memory.high
+is where the kernel starts throttling and reclaiming, so it counts as the limit when lower
+than memory.max. Returns FALSE if no limit is set.
+--*/
+static BOOL
+CGROUPGetMemoryInfo(UINT64 *limit, UINT64 *usage)
+{
+    char cgroupPath[PATH_MAX] = "";
+    char filePath[PATH_MAX + 32];
+
+    // The cgroup v2 entry of /proc/self/cgroup reads "0::<path>". Inside a cgroup namespace the
+    // path is "/" and the controller files sit directly under /sys/fs/cgroup.
+    char buf[2048];
+    int cgroup_fd = open("/proc/self/cgroup", O_RDONLY);
+    if (cgroup_fd != -1)
+    {
+        ssize_t num_read = read(cgroup_fd, buf, sizeof(buf) - 1);
+        close(cgroup_fd);
+        if (num_read > 0)
+        {
+            buf[num_read] = '\0';
+            const char *entry = (strncmp(buf, "0::", 3) == 0) ? buf : strstr(buf, "\n0::");
+            if (entry != nullptr)
+            {
+                entry += (entry == buf) ? 3 : 4;
+                size_t length = 0;
+                while (entry[length] != '\0' && entry[length] != '\n' && length < sizeof(cgroupPath) - 1)
+                {
+                    cgroupPath[length] = entry[length];
+                    length++;
+                }
+                cgroupPath[length] = '\0';
+                if (length == 1 && cgroupPath[0] == '/')
+                {
+                    cgroupPath[0] = '\0';
+                }
+            }
+        }
+    }
+
+    UINT64 maxBytes = 0;
+    UINT64 highBytes = 0;
+    snprintf(filePath, sizeof(filePath), "/sys/fs/cgroup%s/memory.max", cgroupPath);
+    BOOL hasMax = CGROUPReadValue(filePath, &maxBytes);
+    snprintf(filePath, sizeof(filePath), "/sys/fs/cgroup%s/memory.high", cgroupPath);
+    BOOL hasHigh = CGROUPReadValue(filePath, &highBytes);
+    if (hasMax || hasHigh)
+    {
+        *limit = (hasMax && hasHigh) ? (maxBytes < highBytes ? maxBytes : highBytes) : (hasMax ? maxBytes : highBytes);
+        snprintf(filePath, sizeof(filePath), "/sys/fs/cgroup%s/memory.current", cgroupPath);
+        if (!CGROUPReadValue(filePath, usage))
+        {
+            *usage = 0;
+        }
+        return TRUE;
+    }
+
+    // cgroup v1 reports a huge number rather than "max" when unlimited; the caller only uses
+    // the limit when it is below the physical memory.
+    if (CGROUPReadValue("/sys/fs/cgroup/memory/memory.limit_in_bytes", limit))
+    {
+        if (!CGROUPReadValue("/sys/fs/cgroup/memory/memory.usage_in_bytes", usage))
+        {
+            *usage = 0;
+        }
+        return TRUE;
+    }
+
+    return FALSE;
+}
+#endif // __LINUX__
+
 /*++
 Function:
   GlobalMemoryStatusEx
@@ -293,6 +410,20 @@ GlobalMemoryStatusEx(
         lpBuffer->dwMemoryLoad = (DWORD)((used_memory * 100) / lpBuffer->ullTotalPhys);
 #elif defined(__LINUX__)
         lpBuffer->ullAvailPhys = sysconf(SYSCONF_PAGES) * sysconf(_SC_PAGE_SIZE);
+
+        // Report the cgroup's budget when it is tighter than the machine's memory
+        UINT64 cgroupLimit;
+        UINT64 cgroupUsage;
+        if (CGROUPGetMemoryInfo(&cgroupLimit, &cgroupUsage) && cgroupLimit > 0 && cgroupLimit < lpBuffer->ullTotalPhys)
+        {
+            lpBuffer->ullTotalPhys = cgroupLimit;
+            UINT64 cgroupAvail = cgroupUsage < cgroupLimit ? cgroupLimit - cgroupUsage : 0;
+            if (cgroupAvail < lpBuffer->ullAvailPhys)
+            {
+                lpBuffer->ullAvailPhys = cgroupAvail;
+            }
+        }
+
         INT64 used_memory = lpBuffer->ullTotalPhys - lpBuffer->ullAvailPhys;
         lpBuffer->dwMemoryLoad = (DWORD)((used_memory * 100) / lpBuffer->ullTotalPhys);
 #elif defined(__APPLE__)
@@ -349,6 +480,146 @@ PAL_HasGetCurrentProcessorNumber()
     return HAVE_SCHED_GETCPU;
 }
 
+#ifdef __LINUX__
+/*++
+Function:
+  NUMAReadList
+
+Reads a sysfs list such as "0-3,8-11". Sets the bits of the listed numbers below 64 in mask
+and returns the highest number listed. Returns FALSE if the file cannot be read.
+--*/
+static BOOL
+NUMAReadList(const char *path, UINT64 *mask, DWORD *highest)
+{
+    char buf[1024];
+
+    int fd = open(path, O_RDONLY);
+    if (fd == -1)
+    {
+        return FALSE;
+    }
+    ssize_t num_read = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+
+    if (num_read <= 0)
+    {
+        return FALSE;
+    }
+    buf[num_read] = '\0';
+
+    *mask = 0;
+    *highest = 0;
+    const char *current = buf;
+    while (*current >= '0' && *current <= '9')
+    {
+        DWORD first = 0;
+        for (; *current >= '0' && *current <= '9'; current++)
+        {
+            first = first * 10 + (*current - '0');
+        }
+        DWORD last = first;
+        if (*current == '-')
+        {
+            last = 0;
+            for (current++; *current >= '0' && *current <= '9'; current++)
+            {
+                last = last * 10 + (*current - '0');
+            }
+        }
+        for (DWORD i = first; i <= last && i < 64; i++)
+        {
+            *mask |= 1ULL << i;
+        }
+        if (last > *highest)
+        {
+            *highest = last;
+        }
+        if (*current == ',')
+        {
+            current++;
+        }
+    }
+    return TRUE;
+}
+#endif // __LINUX__
+
+/*++
+Function:
+  GetNumaHighestNodeNumber
+
+See MSDN doc. Systems without NUMA report a single node 0.
+--*/
+BOOL
+PALAPI
+GetNumaHighestNodeNumber(
+            OUT PULONG HighestNodeNumber)
+{
+    PERF_ENTRY(GetNumaHighestNodeNumber);
+    ENTRY("GetNumaHighestNodeNumber (HighestNodeNumber=%p)\n", HighestNodeNumber);
+
+    DWORD highest = 0;
+#ifdef __LINUX__
+    UINT64 mask;
+    if (!NUMAReadList("/sys/devices/system/node/online", &mask, &highest))
+    {
+        highest = 0;
+    }
+#endif
+    *HighestNodeNumber = highest;
+
+    LOGEXIT("GetNumaHighestNodeNumber returns BOOL TRUE\n");
+    PERF_EXIT(GetNumaHighestNodeNumber);
+    return TRUE;
+}
+
+/*++
+Function:
+  GetNumaNodeProcessorMask
+
+See MSDN doc. As on Windows the mask only covers the first 64 processors. Without NUMA
+information, node 0 holds every processor.
+--*/
+BOOL
+PALAPI
+GetNumaNodeProcessorMask(
+            IN UCHAR Node,
+            OUT PULONGLONG ProcessorMask)
+{
+    BOOL fRetVal = FALSE;
+
+    PERF_ENTRY(GetNumaNodeProcessorMask);
+    ENTRY("GetNumaNodeProcessorMask (Node=%u, ProcessorMask=%p)\n", Node, ProcessorMask);
+
+#ifdef __LINUX__
+    char path[64];
+    UINT64 mask;
+    DWORD highest;
+    snprintf(path, sizeof(path), "/sys/devices/system/node/node%u/cpulist", (unsigned)Node);
+    if (NUMAReadList(path, &mask, &highest))
+    {
+        *ProcessorMask = mask;
+        fRetVal = TRUE;
+    }
+    else if (Node == 0 && access("/sys/devices/system/node", F_OK) != 0)
+#else
+    if (Node == 0)
+#endif
+    {
+        DWORD processorCount = PAL_GetLogicalCpuCountFromOS();
+        *ProcessorMask = processorCount >= 64 ? ~0ULL : (1ULL << processorCount) - 1;
+        fRetVal = TRUE;
+    }
+
+    if (!fRetVal)
+    {
+        SetLastError(ERROR_INVALID_PARAMETER);
+    }
+
+    LOGEXIT("GetNumaNodeProcessorMask returns BOOL %d\n", fRetVal);
+    PERF_EXIT(GetNumaNodeProcessorMask);
+    return fRetVal;
+}
+
 DWORD
 PALAPI
 PAL_GetLogicalCpuCountFromOS()
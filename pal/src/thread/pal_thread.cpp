@@ -1193,6 +1193,95 @@ CorUnix::InternalSetThreadPriority(
     return palError;
 }
 
+/*++
+Function:
+  SetThreadAffinityMask
+
+See MSDN doc. The mask covers the first 64 processors, as a single processor
+group does on Windows. Only Linux lets a thread be pinned; elsewhere the call
+fails with ERROR_NOT_SUPPORTED.
+--*/
+DWORD_PTR
+PALAPI
+SetThreadAffinityMask(
+          IN HANDLE hThread,
+          IN DWORD_PTR dwThreadAffinityMask)
+{
+    CPalThread *pThread;
+    CPalThread *pTargetThread = NULL;
+    IPalObject *pobjThread = NULL;
+    DWORD_PTR previousMask = 0;
+    PAL_ERROR palError = NO_ERROR;
+
+    PERF_ENTRY(SetThreadAffinityMask);
+    ENTRY("SetThreadAffinityMask(hThread=%p, dwThreadAffinityMask=%p)\n", hThread, (void *)dwThreadAffinityMask);
+
+    pThread = InternalGetCurrentThread();
+
+    palError = InternalGetThreadDataFromHandle(
+        pThread,
+        hThread,
+        0, // THREAD_SET_INFORMATION
+        &pTargetThread,
+        &pobjThread
+        );
+
+    if (NO_ERROR == palError)
+    {
+#ifdef __LINUX__
+        const int maskBits = (int)(sizeof(DWORD_PTR) * 8);
+        cpu_set_t cpuSet;
+
+        CPU_ZERO(&cpuSet);
+        if (pthread_getaffinity_np(pTargetThread->GetPThreadSelf(), sizeof(cpuSet), &cpuSet) == 0)
+        {
+            for (int i = 0; i < maskBits; i++)
+            {
+                if (CPU_ISSET(i, &cpuSet))
+                {
+                    previousMask |= (DWORD_PTR)1 << i;
+                }
+            }
+        }
+
+        CPU_ZERO(&cpuSet);
+        for (int i = 0; i < maskBits; i++)
+        {
+            if ((dwThreadAffinityMask & ((DWORD_PTR)1 << i)) != 0)
+            {
+                CPU_SET(i, &cpuSet);
+            }
+        }
+
+        int st = pthread_setaffinity_np(pTargetThread->GetPThreadSelf(), sizeof(cpuSet), &cpuSet);
+        if (st != 0)
+        {
+            TRACE("pthread_setaffinity_np failed (error %d)\n", st);
+            palError = ERROR_INVALID_PARAMETER;
+        }
+        else if (previousMask == 0)
+        {
+            // The thread only ran on processors above the mask; 0 would read as failure
+            previousMask = ~(DWORD_PTR)0;
+        }
+#else
+        palError = ERROR_NOT_SUPPORTED;
+#endif
+        pobjThread->ReleaseReference(pThread);
+    }
+
+    if (NO_ERROR != palError)
+    {
+        pThread->SetLastError(palError);
+        previousMask = 0;
+    }
+
+    LOGEXIT("SetThreadAffinityMask returns DWORD_PTR %p\n", (void *)previousMask);
+    PERF_EXIT(SetThreadAffinityMask);
+
+    return previousMask;
+}
+
 #define SECS_TO_NS 1000000000 /* 10^9 */
 #define USECS_TO_NS 1000 /* 10^3 */
 
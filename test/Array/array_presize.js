@@ -0,0 +1,108 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Array literal and Array constructor call sites learn how large the head segment of the arrays they
+// allocate grows, and presize later allocations. The presized arrays must look exactly like the ones
+// that grew.
+
+var failed = false;
+
+function check(arr, expected, name)
+{
+    if (arr.length !== expected.length)
+    {
+        print(name + ": length " + arr.length + ", expected " + expected.length);
+        failed = true;
+        return;
+    }
+    for (var i = 0; i < expected.length; i++)
+    {
+        if (!(i in arr) || arr[i] !== expected[i])
+        {
+            print(name + ": [" + i + "] = " + arr[i] + ", expected " + expected[i]);
+            failed = true;
+            return;
+        }
+    }
+    if (arr.length in arr || arr[arr.length] !== undefined)
+    {
+        print(name + ": element past the end");
+        failed = true;
+    }
+}
+
+function pushInts(n)
+{
+    var arr = [];
+    for (var i = 0; i < n; i++)
+    {
+        arr.push(i);
+    }
+    return arr;
+}
+
+function storeFloats(n)
+{
+    var arr = [0.5];
+    for (var i = 1; i < n; i++)
+    {
+        arr[i] = i + 0.5;
+    }
+    return arr;
+}
+
+function pushVars(n)
+{
+    var arr = new Array();
+    for (var i = 0; i < n; i++)
+    {
+        arr.push("s" + i);
+    }
+    return arr;
+}
+
+function literalThenHole()
+{
+    var arr = [1, 2, 3];
+    for (var i = 3; i < 20; i++)
+    {
+        arr[i] = i;
+    }
+    var small = [4, 5];
+    return [arr, small];
+}
+
+function expectedInts(n) { var r = []; for (var i = 0; i < n; i++) { r[r.length] = i; } return r; }
+function expectedFloats(n) { var r = []; for (var i = 0; i < n; i++) { r[r.length] = i + 0.5; } return r; }
+function expectedVars(n) { var r = []; for (var i = 0; i < n; i++) { r[r.length] = "s" + i; } return r; }
+
+for (var iter = 0; iter < 200; iter++)
+{
+    // Vary the final size so that presized arrays are both larger and smaller than what they end up holding
+    var n = (iter % 3 === 0) ? 40 : (iter % 3 === 1) ? 5 : 100;
+    check(pushInts(n), expectedInts(n), "pushInts(" + n + ")");
+    check(storeFloats(n), expectedFloats(n), "storeFloats(" + n + ")");
+    check(pushVars(n), expectedVars(n), "pushVars(" + n + ")");
+
+    var arrays = literalThenHole();
+    check(arrays[0], [1, 2, 3].concat(expectedInts(20).slice(3)), "literalThenHole");
+    check(arrays[1], [4, 5], "literalThenHole small");
+
+    var empty = pushInts(0);
+    check(empty, [], "pushInts(0)");
+    empty[60] = 1;
+    if (empty.length !== 61 || 0 in empty || 59 in empty)
+    {
+        print("sparse store into presized array");
+        failed = true;
+    }
+
+    if (failed)
+    {
+        break;
+    }
+}
+
+print(failed ? "FAILED" : "pass");
@@ -0,0 +1,46 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Traces the head segment size that array literals are presized to once their call site has seen the
+// arrays it allocates grow. The first call at each site grows its array past INLINE_CHUNK_SIZE, so later
+// calls get a head segment for INLINE_CHUNK_SIZE (64) elements. Arrays that never grow are not presized.
+
+function pushInts(n)
+{
+    var arr = [];
+    for (var i = 0; i < n; i++)
+    {
+        arr.push(i);
+    }
+    return arr;
+}
+
+function storeInts(n)
+{
+    var arr = [];
+    for (var i = 0; i < n; i++)
+    {
+        arr[i] = i;
+    }
+    return arr;
+}
+
+function small()
+{
+    var arr = [];
+    arr.push(1);
+    arr.push(2);
+    return arr;
+}
+
+var total = 0;
+for (var iter = 0; iter < 3; iter++)
+{
+    total += pushInts(100).length;
+    total += storeInts(100).length;
+    total += small().length;
+}
+
+print(total === 606 ? "pass" : "FAILED: " + total);
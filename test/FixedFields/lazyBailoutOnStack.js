@@ -0,0 +1,111 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Redefine a fixed global while jitted frames that depend on it are on the stack, including frames
+// of the same function further down a recursion, and frames still running an entry point that is no
+// longer the function's default one because the function was rejitted underneath them.
+
+var K = 1;
+var proto = { get: function () { return 10; } };
+var obj = Object.create(proto);
+
+function change(depth, i) {
+    if (depth === 0 && i === 5) {
+        K = 100;
+        proto.get = function () { return 1000; };
+    }
+}
+
+function sum(depth, n) {
+    var total = 0;
+    for (var i = 0; i < n; i++) {
+        total += K + obj.get();
+        change(depth, i);
+        if (depth > 0 && i === 2) {
+            total += sum(depth - 1, n);
+        }
+    }
+    return total;
+}
+
+for (var i = 0; i < 20; i++) {
+    sum(0, 3);
+}
+
+var result = sum(2, 8);
+K = 1;
+proto.get = function () { return 10; };
+var expected = 0;
+(function () {
+    // Same computation in the interpreter-friendly form: the change happens at step 5 of the innermost call,
+    // which runs during step 2 of the outer ones.
+    function model(depth, state) {
+        var total = 0;
+        for (var i = 0; i < 8; i++) {
+            total += state.k + state.m;
+            if (depth === 0 && i === 5) {
+                state.k = 100;
+                state.m = 1000;
+            }
+            if (depth > 0 && i === 2) {
+                total += model(depth - 1, state);
+            }
+        }
+        return total;
+    }
+    expected = model(2, { k: 1, m: 10 });
+})();
+
+if (result !== expected) {
+    print("fail: " + result + " !== " + expected);
+}
+
+// The frames of rejitted() further up the stack run its first, int specialized entry point. Passing it a
+// double from the innermost frame bails out of that entry point until the function is rejitted, which
+// gives it a new default entry point. Only then is the fixed global changed, so the old frames are not
+// running the default entry point when they are lazily bailed out.
+var L = 1;
+var phase = 0;
+
+function rejitThenChange() {
+    for (var j = 0; j < 100; j++) {
+        rejitted(0, 0.5);
+    }
+    L = 100;
+}
+
+function rejitted(depth, x) {
+    var total = 0;
+    for (var i = 0; i < 4; i++) {
+        total += L + x;
+        if (i === 1) {
+            if (depth > 0) {
+                total += rejitted(depth - 1, x);
+            } else if (phase === 1) {
+                phase = 2;
+                rejitThenChange();
+            }
+        }
+    }
+    return total;
+}
+
+for (var i = 0; i < 20; i++) {
+    rejitted(2, 1);
+}
+phase = 1;
+var rejittedResult = rejitted(2, 1);
+
+// Each frame adds L + 1 twice before the change and twice after it, plus what the frame below it returns
+var rejittedExpected = 0;
+for (var depth = 0; depth <= 2; depth++) {
+    rejittedExpected += 2 * (1 + 1) + 2 * (100 + 1);
+}
+
+if (rejittedResult !== rejittedExpected) {
+    print("fail: " + rejittedResult + " !== " + rejittedExpected);
+}
+
+print(result === expected && rejittedResult === rejittedExpected ? "pass" : "fail");
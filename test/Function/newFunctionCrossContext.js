@@ -0,0 +1,43 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var tests = [
+  {
+    name: "Same new Function source compiled in several contexts on one thread",
+    body: function () {
+      for (var i = 0; i < 4; i++) {
+        var child = WScript.LoadScript("", "samethread");
+        var add = new child.Function("a", "b", "return a + b;");
+        assert.areEqual(3, add(1, 2), "function created in context " + i + " should work");
+        assert.areEqual(child.Function.prototype, Object.getPrototypeOf(add), "function should belong to the creating context");
+      }
+    }
+  },
+  {
+    name: "Validation is not shared between different formals/body splits of the same source",
+    body: function () {
+      var valid = new Function("a", "/*\n) {*/ return a;");
+      assert.areEqual(5, valid(5), "valid split should compile");
+
+      var child = WScript.LoadScript("", "samethread");
+      assert.throws(function () { new child.Function("a\n) {/*", "*/ return a;"); }, child.SyntaxError,
+        "formals must still be validated in another context");
+    }
+  },
+  {
+    name: "Syntax errors are reported in every context",
+    body: function () {
+      for (var i = 0; i < 3; i++) {
+        var child = WScript.LoadScript("", "samethread");
+        assert.throws(function () { new child.Function("a", "}); (function() {"); }, child.SyntaxError,
+          "invalid body should throw in context " + i);
+      }
+    }
+  },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
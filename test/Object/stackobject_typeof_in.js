@@ -0,0 +1,46 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+var leak;
+
+function test1(n)
+{
+    var sum = 0;
+    for (var i = 0; i < n; i++)
+    {
+        var o = { x: i, y: 1 };
+        if (typeof o === "object" && "x" in o && !("z" in o))
+        {
+            sum += o.x + o.y;
+        }
+    }
+    return sum;
+}
+
+WScript.Echo(test1(10));
+WScript.Echo(test1(10));
+WScript.Echo(test1(100));
+
+// The object used as the key of 'in' is converted with toString, so it can escape
+function test2(n)
+{
+    var count = 0;
+    var target = { key: 1 };
+    for (var i = 0; i < n; i++)
+    {
+        var o = { i: i, toString: function () { leak = this; return "key"; } };
+        if (o in target)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+WScript.Echo(test2(10));
+WScript.Echo(test2(10));
+WScript.Echo(leak.i);
+test1(5);
+WScript.Echo(leak.i);
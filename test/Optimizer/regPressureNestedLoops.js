@@ -0,0 +1,34 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// More live values than registers across nested loops, so the allocator has to spill in the inner loop.
+// Some values are only used after the loops, some only in the outer loop and some in the inner loop.
+
+function test(n, m, bias) {
+    var a = bias + 1, b = bias + 2, c = bias + 3, d = bias + 4, e = bias + 5, f = bias + 6, g = bias + 7, h = bias + 8;
+    var p = a * 2, q = b * 2, r = c * 2, s = d * 2, t = e * 2, u = f * 2, v = g * 2, w = h * 2;
+    var x = 0.5 + bias, y = 1.5 + bias, z = 2.5 + bias;
+    var sum = 0, fsum = 0;
+    for (var i = 0; i < n; i++) {
+        sum += p + q;
+        for (var j = 0; j < m; j++) {
+            sum = (sum + a * i + b * j + c - d + (e ^ f) + (g | h)) | 0;
+            fsum += x * j + y - z;
+        }
+        sum = (sum + r - s) | 0;
+    }
+    return [sum, fsum, t + u + v + w];
+}
+
+var expected = JSON.stringify(test(20, 30, 1));
+var passed = true;
+for (var k = 0; k < 200; k++) {
+    if (JSON.stringify(test(20, 30, 1)) !== expected) {
+        passed = false;
+        print("FAILED on iteration " + k + ": " + JSON.stringify(test(20, 30, 1)) + " !== " + expected);
+        break;
+    }
+}
+print(passed ? "pass" : "fail");
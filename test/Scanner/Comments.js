@@ -0,0 +1,90 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function pad(n) {
+    return "abcdefghijklmnopqrstuvwxyz".repeat(2).substring(0, n);
+}
+
+var tests = [
+    {
+        name: "Block comments of every length around the word size",
+        body: function () {
+            for (var i = 0; i < 40; i++) {
+                assert.areEqual(3, eval("1 /*" + pad(i) + "*/ + 2"), "comment body of length " + i);
+                assert.areEqual(3, eval("1 /*" + pad(i) + "**/ + 2"), "comment ending in ** at length " + i);
+                assert.areEqual(3, eval("1 /*" + pad(i) + "* / *" + pad(i) + "*/ + 2"), "star inside comment at " + i);
+            }
+        }
+    },
+    {
+        name: "Line terminators inside block comments are still seen",
+        body: function () {
+            for (var i = 0; i < 20; i++) {
+                assert.areEqual(undefined, eval("(function () { return /*" + pad(i) + "\n" + pad(i) + "*/ 1; })()"), "LF at " + i);
+                assert.areEqual(undefined, eval("(function () { return /*" + pad(i) + "\r" + pad(i) + "*/ 1; })()"), "CR at " + i);
+                assert.areEqual(undefined, eval("(function () { return /*" + pad(i) + "\u2028" + pad(i) + "*/ 1; })()"), "LS at " + i);
+                assert.areEqual(1, eval("(function () { return /*" + pad(i) + pad(i) + "*/ 1; })()"), "no line terminator at " + i);
+            }
+        }
+    },
+    {
+        name: "Line comments of every length",
+        body: function () {
+            for (var i = 0; i < 40; i++) {
+                assert.areEqual(3, eval("1 //" + pad(i) + "\n + 2"), "LF terminated line comment of length " + i);
+                assert.areEqual(3, eval("1 //" + pad(i) + "\r\n + 2"), "CRLF terminated line comment of length " + i);
+                assert.areEqual(3, eval("1 //" + pad(i) + "\u2029 + 2"), "PS terminated line comment of length " + i);
+                assert.areEqual(1, eval("1 //" + pad(i)), "line comment at end of source, length " + i);
+            }
+        }
+    },
+    {
+        name: "Non-ASCII characters inside comments",
+        body: function () {
+            assert.areEqual(5, eval("/* \u00e9\u65e5\u672c \ud83d\ude00 */ 5"), "block comment");
+            assert.areEqual(5, eval("// \u00e9\u65e5\u672c \ud83d\ude00\n5"), "line comment");
+            assert.areEqual(5, eval("/*" + pad(13) + "\u00e9" + pad(9) + "*/5"), "non-ASCII character in the middle of a word");
+        }
+    },
+    {
+        name: "Comments in the UTF-8 source file itself",
+        body: function () {
+            function withLineBreak() {
+                return /* ASCII run, then é and 日本語, then ** stars ***
+                          and a line break, so ASI applies */ 1;
+            }
+            function withoutLineBreak() {
+                return /* ASCII run, then é and 日本語, then ** stars *** */ 1;
+            }
+            function lineComment() {
+                var x = 1; // trailing comment with é and 日本語 *** /* */
+                return x;
+            }
+            assert.areEqual(undefined, withLineBreak(), "line break inside a block comment");
+            assert.areEqual(1, withoutLineBreak(), "block comment without line break");
+            assert.areEqual(1, lineComment(), "line comment");
+        }
+    },
+    {
+        name: "Unterminated block comments are still reported",
+        body: function () {
+            for (var i = 0; i < 20; i++) {
+                assert.throws(function () { eval("1 /*" + pad(i)); }, SyntaxError, "unterminated comment of length " + i);
+                assert.throws(function () { eval("1 /*" + pad(i) + "*"); }, SyntaxError, "unterminated comment ending in * of length " + i);
+            }
+        }
+    },
+    {
+        name: "Runs of indentation",
+        body: function () {
+            assert.areEqual(3, eval("\t\t    1 +\t \t  \t2    \t"), "mixed tabs and spaces");
+            assert.areEqual(3, eval("        \n        1\n        +\n        2"), "indented lines");
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,162 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// for-of over built-in Map and Set iterators steps them without calling next; make sure that
+// stays unobservable and that replacing next falls back to the call.
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+function sumKeys(map) {
+    var sum = 0;
+    for (var k of map.keys()) {
+        sum += k;
+    }
+    return sum;
+}
+
+var tests = [
+    {
+        name: "Map and Set iteration kinds",
+        body: function () {
+            var map = new Map([[1, "a"], [2, "b"], [3, "c"]]);
+            var set = new Set(["x", "y"]);
+
+            var seen = [];
+            for (var [k, v] of map) {
+                seen.push(k + v);
+            }
+            assert.areEqual("1a,2b,3c", seen.join(), "Map default iterator yields entries");
+
+            seen = [];
+            for (var v of map.values()) {
+                seen.push(v);
+            }
+            assert.areEqual("a,b,c", seen.join(), "Map values iterator");
+
+            seen = [];
+            for (var e of set.entries()) {
+                seen.push(e[0] + e[1]);
+            }
+            assert.areEqual("xx,yy", seen.join(), "Set entries iterator");
+
+            for (var i = 0; i < 50; i++) {
+                assert.areEqual(6, sumKeys(map), "Map keys iterator (repeated so the loop is jitted)");
+            }
+        }
+    },
+    {
+        name: "Entries yielded for Map are distinct arrays",
+        body: function () {
+            var map = new Map([[1, 1], [2, 2]]);
+            var entries = [];
+            for (var entry of map) {
+                entries.push(entry);
+            }
+            assert.areEqual(2, entries.length);
+            assert.isTrue(entries[0] !== entries[1], "Each step must produce its own [key, value] array");
+            assert.areEqual(2, entries[1][0]);
+        }
+    },
+    {
+        name: "Nested loops over the same and different collections",
+        body: function () {
+            var set = new Set([1, 2, 3]);
+            var map = new Map([["a", 10], ["b", 20]]);
+            var pairs = [];
+            for (var x of set) {
+                for (var y of set) {
+                    for (var [k, v] of map) {
+                        pairs.push(x * y + v);
+                    }
+                }
+            }
+            assert.areEqual(18, pairs.length);
+            assert.areEqual(11, pairs[0]);
+            assert.areEqual(29, pairs[17]);
+        }
+    },
+    {
+        name: "Mutation during iteration",
+        body: function () {
+            var set = new Set([1, 2, 3]);
+            var seen = [];
+            for (var x of set) {
+                seen.push(x);
+                if (x === 1) {
+                    set.delete(2);
+                    set.add(4);
+                }
+            }
+            assert.areEqual("1,3,4", seen.join(), "Deleted entries are skipped and added ones are visited");
+        }
+    },
+    {
+        name: "Early exit and resuming the same iterator",
+        body: function () {
+            var it = new Set([1, 2, 3, 4]).values();
+            it.return = undefined;
+            for (var x of it) {
+                if (x === 2) {
+                    break;
+                }
+            }
+            var rest = [];
+            for (var x of it) {
+                rest.push(x);
+            }
+            assert.areEqual("3,4", rest.join(), "Second loop picks up where the first one stopped");
+            assert.areEqual(true, it.next().done, "Exhausted iterator stays done");
+        }
+    },
+    {
+        name: "Replaced next is called",
+        body: function () {
+            var map = new Map([[1, 1], [2, 2]]);
+            var proto = Object.getPrototypeOf(map[Symbol.iterator]());
+            var originalNext = proto.next;
+            var calls = 0;
+            proto.next = function () {
+                calls++;
+                return originalNext.call(this);
+            };
+            try {
+                var count = 0;
+                for (var e of map) {
+                    count++;
+                }
+                assert.areEqual(2, count);
+                assert.areEqual(3, calls, "User-defined next must be called for every step");
+            } finally {
+                proto.next = originalNext;
+            }
+        }
+    },
+    {
+        name: "next taken from another iterator kind",
+        body: function () {
+            var setIterator = new Set([1]).values();
+            var mapNext = Object.getPrototypeOf(new Map().values()).next;
+            setIterator.next = mapNext;
+            assert.throws(function () { for (var x of setIterator) { } }, TypeError, "Map Iterator next on a Set iterator throws");
+        }
+    },
+    {
+        name: "for-of inside a generator",
+        body: function () {
+            function* gen(set) {
+                for (var x of set) {
+                    yield x * 2;
+                }
+            }
+            var out = [];
+            for (var v of gen(new Set([1, 2, 3]))) {
+                out.push(v);
+            }
+            assert.areEqual("2,4,6", out.join());
+        }
+    },
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });
@@ -0,0 +1,58 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+let log = [];
+
+// Many awaits in one execution of an async function, alternating between fulfilled
+// and rejected values, so that both resumption paths are taken repeatedly.
+
+async function mixed(count) {
+    let total = 0;
+    for (let i = 0; i < count; i++) {
+        if (i % 3 == 0) {
+            try {
+                await Promise.reject(i);
+            } catch (e) {
+                total -= e;
+            }
+        } else if (i % 3 == 1) {
+            total += await Promise.resolve(i);
+        } else {
+            total += await i;
+        }
+    }
+    return total;
+}
+
+async function rejectsAfterAwaits() {
+    await 1;
+    await Promise.resolve(2);
+    try {
+        await Promise.reject("caught");
+    } catch (e) {
+        log.push(e);
+    }
+    await 3;
+    throw "uncaught";
+}
+
+// Two executions of the same async function interleaved with each other
+async function interleaved(name, count) {
+    for (let i = 0; i < count; i++) {
+        await null;
+        log.push(name + " " + i);
+    }
+    return name + " done";
+}
+
+Promise.all([
+    mixed(30),
+    rejectsAfterAwaits().then(result => "unexpected " + result, error => "rejected " + error),
+    interleaved("a", 3),
+    interleaved("b", 3)
+]).then(results => {
+    results.forEach(result => print(result));
+    print(log.join(", "));
+}, error => print("unexpected " + error));
@@ -0,0 +1,57 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Call sites with very different frequencies within the same inliner, including a polymorphic one,
+// to exercise the hot and cold call site weighting of the inliner.
+
+function add(a, b) { return a + b; }
+function sub(a, b) { return a - b; }
+function mul(a, b) { return a * b; }
+
+function rare(a)
+{
+    var s = 0;
+    for (var i = 0; i < 3; i++)
+    {
+        s = add(s, a);
+    }
+    return s;
+}
+
+function Point(x, y) { this.x = x; this.y = y; }
+
+function test(n, ops)
+{
+    var sum = 0;
+    for (var i = 0; i < n; i++)
+    {
+        sum = add(sum, i);                      // hot, monomorphic
+        sum = ops[i % ops.length](sum, 1);      // hot, polymorphic
+        if (i % 50 === 0)
+        {
+            sum = sub(sum, rare(i));            // cold
+            sum += new Point(i, i).x;           // cold constructor
+        }
+    }
+    return sum;
+}
+
+var ops = [add, sub, mul];
+var expected;
+for (var iter = 0; iter < 20; iter++)
+{
+    var result = test(200, ops);
+    if (expected === undefined)
+    {
+        expected = result;
+    }
+    else if (result !== expected)
+    {
+        print("FAILED: iteration " + iter + " returned " + result + ", expected " + expected);
+        break;
+    }
+}
+
+print(expected === test(200, ops) ? "PASSED" : "FAILED");
@@ -0,0 +1,46 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Functions and loop bodies that all count as large work items, queued in bursts while the background
+// threads are busy, to exercise the placement of large jobs behind the prioritized ones in the jit queue.
+// Debug builds check the queue order as each large job is added.
+
+function leaf(a, b) { return (a * 31 + b) | 0; }
+function mid(a, b) { return leaf(a, b) + leaf(b, a); }
+
+function makeWorker(k)
+{
+    return new Function("leaf", "mid",
+        "return function worker" + k + "(n) {" +
+        "  var s = " + k + ";" +
+        "  for (var i = 0; i < n; i++) { s = (s + mid(i, " + k + ") + leaf(s, i)) | 0; }" +
+        "  return s;" +
+        "};")(leaf, mid);
+}
+
+var workers = [];
+for (var k = 0; k < 12; k++)
+{
+    workers.push(makeWorker(k));
+}
+
+var expected = [];
+for (var round = 0; round < 10; round++)
+{
+    for (var k = 0; k < workers.length; k++)
+    {
+        var result = workers[k](round === 0 ? 1 : 50);
+        if (round === 1)
+        {
+            expected[k] = result;
+        }
+        else if (round > 1 && result !== expected[k])
+        {
+            print("FAILED: worker" + k + " returned " + result + " in round " + round + ", expected " + expected[k]);
+        }
+    }
+}
+
+print("pass");
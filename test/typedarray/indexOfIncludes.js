@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------------------------------------------
+// Copyright (C) Microsoft. All rights reserved.
+// Licensed under the MIT license. See LICENSE.txt file in the project root for full license information.
+//-------------------------------------------------------------------------------------------------------
+
+// Verifies indexOf/includes on TypedArrays, which search the backing store directly
+
+WScript.LoadScriptFile("..\\UnitTestFramework\\UnitTestFramework.js");
+
+var intCtors = [Int8Array, Uint8Array, Uint8ClampedArray, Int16Array, Uint16Array, Int32Array, Uint32Array];
+var floatCtors = [Float32Array, Float64Array];
+var allCtors = intCtors.concat(floatCtors);
+
+function fill(ctor, length) {
+    var ta = new ctor(length);
+    for (var i = 0; i < length; i++) {
+        ta[i] = i % 100;
+    }
+    return ta;
+}
+
+var tests = [
+    {
+        name: "Matches in the block and tail portions of the scan",
+        body: function () {
+            allCtors.forEach(function (ctor) {
+                var ta = fill(ctor, 70);
+                assert.areEqual(0, ta.indexOf(0), ctor.name);
+                assert.areEqual(15, ta.indexOf(15), ctor.name);
+                assert.areEqual(16, ta.indexOf(16), ctor.name);
+                assert.areEqual(69, ta.indexOf(69), ctor.name);
+                assert.areEqual(-1, ta.indexOf(70), ctor.name);
+                assert.areEqual(-1, ta.indexOf(5, 6), ctor.name);
+                assert.areEqual(40, ta.indexOf(40, 33), ctor.name);
+                assert.areEqual(40, ta.indexOf(40, -30), ctor.name);
+                assert.isTrue(ta.includes(69), ctor.name);
+                assert.isFalse(ta.includes(69, 70), ctor.name);
+            });
+        }
+    },
+    {
+        name: "Search values that can't be stored in the element type are not found",
+        body: function () {
+            intCtors.forEach(function (ctor) {
+                var ta = fill(ctor, 20);
+                assert.areEqual(-1, ta.indexOf(1.5), ctor.name);
+                assert.areEqual(-1, ta.indexOf(256 + 1), ctor.name);
+                assert.areEqual(-1, ta.indexOf(4294967296 + 1), ctor.name);
+                assert.areEqual(-1, ta.indexOf(-4294967296), ctor.name);
+                assert.areEqual(-1, ta.indexOf(Infinity), ctor.name);
+                assert.isFalse(ta.includes(NaN), ctor.name);
+            });
+
+            assert.areEqual(-1, new Int8Array([-1]).indexOf(255));
+            assert.areEqual(0, new Int8Array([-1]).indexOf(-1));
+            assert.areEqual(-1, new Uint8Array([255]).indexOf(-1));
+            assert.areEqual(0, new Uint32Array([4294967295]).indexOf(4294967295));
+            assert.areEqual(0, new Int32Array([-2147483648]).indexOf(-2147483648));
+            assert.areEqual(0, new Uint8ClampedArray([300]).indexOf(255));
+            assert.areEqual(-1, new Float32Array([0.1]).indexOf(0.1));
+            assert.areEqual(0, new Float32Array([0.5]).indexOf(0.5));
+            assert.areEqual(-1, new Float32Array([1]).indexOf(1e300));
+            assert.areEqual(0, new Float32Array([Infinity]).indexOf(Infinity));
+            assert.areEqual(0, new Float64Array([0.1]).indexOf(0.1));
+        }
+    },
+    {
+        name: "Non-number search values are never found",
+        body: function () {
+            allCtors.forEach(function (ctor) {
+                var ta = fill(ctor, 20);
+                assert.areEqual(-1, ta.indexOf("1"), ctor.name);
+                assert.areEqual(-1, ta.indexOf({ valueOf: function () { return 1; } }), ctor.name);
+                assert.isFalse(ta.includes(undefined), ctor.name);
+                assert.isFalse(ta.includes(null), ctor.name);
+            });
+        }
+    },
+    {
+        name: "NaN and signed zero",
+        body: function () {
+            floatCtors.forEach(function (ctor) {
+                var ta = new ctor(40);
+                ta[33] = NaN;
+                ta[34] = -0;
+                assert.areEqual(-1, ta.indexOf(NaN), ctor.name);
+                assert.isTrue(ta.includes(NaN), ctor.name);
+                assert.isFalse(ta.includes(NaN, 34), ctor.name);
+                assert.areEqual(0, ta.indexOf(-0), ctor.name);
+                assert.areEqual(34, ta.indexOf(0, 34), ctor.name);
+            });
+        }
+    },
+    {
+        name: "Detaching the buffer from the fromIndex conversion",
+        body: function () {
+            var ta = fill(Int32Array, 20);
+            var fromIndex = { valueOf: function () { ArrayBuffer.detach(ta.buffer); return 0; } };
+            assert.areEqual(-1, ta.indexOf(1, fromIndex));
+        }
+    }
+];
+
+testRunner.runTests(tests, { verbose: WScript.Arguments[0] != "summary" });